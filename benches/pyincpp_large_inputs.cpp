@@ -0,0 +1,504 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <functional>
+#include <memory_resource>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "../sources/pyincpp.hpp"
+
+using namespace pyincpp;
+
+// Memory resource which counts its allocations, to count the allocations of the containers which use it.
+class CountingResource : public std::pmr::memory_resource
+{
+private:
+    std::size_t count_ = 0;
+
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override
+    {
+        ++count_;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override
+    {
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& that) const noexcept override
+    {
+        return this == &that;
+    }
+
+public:
+    std::size_t count() const
+    {
+        return count_;
+    }
+};
+
+TEST_CASE("Str with large inputs", "[large]")
+{
+    const int n = 1'000'000;
+
+    auto text = Str("ab") * n;
+    REQUIRE(text.replace("a", "xyz").size() == 4 * n);
+    BENCHMARK("replace 10^6 (grow)")
+    {
+        return text.replace("a", "xyz");
+    };
+    REQUIRE(text.replace("ab", "c").size() == n);
+    BENCHMARK("replace 10^6 (shrink)")
+    {
+        return text.replace("ab", "c");
+    };
+    REQUIRE(text.replace("", "-").size() == 4 * n + 1);
+    BENCHMARK("replace 10^6 (empty pattern)")
+    {
+        return text.replace("", "-");
+    };
+
+    auto words = List<Str>(std::vector<Str>(n, "word"));
+    REQUIRE(Str(", ").join(words).size() == 6 * n - 2);
+    BENCHMARK("join 10^6")
+    {
+        return Str(", ").join(words);
+    };
+}
+
+TEST_CASE("Str number parsing with large inputs", "[large]")
+{
+    const int n = 1'000'000;
+
+    std::string column;
+    for (int i = 0; i < n; ++i)
+    {
+        column += std::to_string(i * 0.001 - 123.456) + ",";
+    }
+    column += "0";
+    auto text = Str(column);
+
+    REQUIRE(text.parse_decimals().size() == n + 1);
+    BENCHMARK("parse_decimals 10^6")
+    {
+        return text.parse_decimals();
+    };
+
+    auto one = Str("-12345.6789e-3");
+    REQUIRE(one.to_decimal() == -12.3456789);
+    BENCHMARK("to_decimal")
+    {
+        return one.to_decimal();
+    };
+
+    std::string ints;
+    for (int i = 0; i < n; ++i)
+    {
+        ints += std::to_string((i - n / 2) * 1'000'003LL) + ",";
+    }
+    ints += "0";
+    auto int_text = Str(ints);
+
+    REQUIRE(int_text.parse_ints().size() == n + 1);
+    BENCHMARK("parse_ints 10^6")
+    {
+        return int_text.parse_ints();
+    };
+    BENCHMARK("parse_ints<Int> 10^6")
+    {
+        return int_text.parse_ints<Int>();
+    };
+
+    auto one_int = Str("-1234567890123456789");
+    REQUIRE(one_int.to_int64() == -1234567890123456789LL);
+    BENCHMARK("to_int64")
+    {
+        return one_int.to_int64();
+    };
+    BENCHMARK("to_integer")
+    {
+        return one_int.to_integer();
+    };
+}
+
+TEST_CASE("Hash tables with large inputs", "[large]")
+{
+    const int n = 100'000;
+
+    std::vector<Int> ints;
+    std::vector<Str> strs;
+    for (int i = 0; i < n; ++i)
+    {
+        ints.push_back(Int(i) * Int("1000000000000000000")); // same chunks in different positions before
+        strs.push_back(Str("key_") + Str(std::to_string(i)));
+    }
+
+    BENCHMARK("unordered_set<Int> insert 10^5")
+    {
+        return std::unordered_set<Int>(ints.begin(), ints.end()).size();
+    };
+
+    std::unordered_map<Str, int> map;
+    for (int i = 0; i < n; ++i)
+    {
+        map[strs[i]] = i;
+    }
+    BENCHMARK("unordered_map<Str, int> lookup 10^5 (cached hash)")
+    {
+        long long sum = 0;
+        for (const auto& key : strs)
+        {
+            sum += map.find(key)->second;
+        }
+        return sum;
+    };
+}
+
+TEST_CASE("List uniquify with large inputs", "[large]")
+{
+    // half of the elements are duplicates, the copy of the list is included in the time
+    for (int n = 10'000, e = 4; n <= 10'000'000; n *= 10, ++e)
+    {
+        List<int> ints;
+        for (int i = 0; i < n; ++i)
+        {
+            ints += i % (n / 2);
+        }
+        REQUIRE(List<int>(ints).uniquify().size() == n / 2);
+        BENCHMARK("uniquify List<int> 10^" + std::to_string(e))
+        {
+            return List<int>(ints).uniquify().size();
+        };
+    }
+
+    const int n = 1'000'000;
+    List<Str> strs;
+    List<Int> ints;
+    for (int i = 0; i < n; ++i)
+    {
+        strs += Str("key_") + Str(std::to_string(i % (n / 2)));
+        ints += Int(i % (n / 2)) * Int("1000000000000000000");
+    }
+    BENCHMARK("uniquify List<Str> 10^6")
+    {
+        return List<Str>(strs).uniquify().size();
+    };
+    BENCHMARK("uniquify List<Int> 10^6")
+    {
+        return List<Int>(ints).uniquify().size();
+    };
+}
+
+TEST_CASE("List sort with large inputs", "[large]")
+{
+    const int n = 10'000'000;
+
+    std::mt19937 gen(233);
+    List<int> ints;
+    for (int i = 0; i < n; ++i)
+    {
+        ints += int(gen());
+    }
+    BENCHMARK("sort 10^7")
+    {
+        return List<int>(ints).sort()[0];
+    };
+    BENCHMARK("sort 10^7 (key)")
+    {
+        return List<int>(ints).sort([](int e)
+                                    { return -e; })[0];
+    };
+    BENCHMARK("parallel_sort 10^7")
+    {
+        return List<int>(ints).parallel_sort()[0];
+    };
+    BENCHMARK("sort 10^7 (comparator)")
+    {
+        return List<int>(ints).sort([](int e1, int e2)
+                                    { return e1 < e2; })[0];
+    };
+
+    List<Str> strs;
+    for (int i = 0; i < n / 10; ++i)
+    {
+        strs += Str("key_") + Str(std::to_string(gen() % 1000000));
+    }
+    BENCHMARK("sort List<Str> 10^6")
+    {
+        return List<Str>(strs).sort()[0];
+    };
+    BENCHMARK("sort List<Str> 10^6 (comparator)")
+    {
+        return List<Str>(strs).sort([](const Str& e1, const Str& e2)
+                                    { return e1 < e2; })[0];
+    };
+}
+
+TEST_CASE("List pipeline with large inputs", "[large]")
+{
+    const int n = 10'000'000;
+
+    List<long long> list;
+    for (int i = 0; i < n; ++i)
+    {
+        list += i;
+    }
+
+    BENCHMARK("eager map/filter/map/filter/slice 10^7")
+    {
+        return List<long long>(list)
+            .map([](long long& x)
+                 { x *= 3; })
+            .filter([](long long x)
+                    { return x % 2 == 0; })
+            .map([](long long& x)
+                 { x += 1; })
+            .filter([](long long x)
+                    { return x % 5 != 0; })
+            .slice(0, n / 4)
+            .size();
+    };
+    BENCHMARK("lazy map/filter/map/filter/take 10^7")
+    {
+        return list.lazy()
+            .map([](long long x)
+                 { return x * 3; })
+            .filter([](long long x)
+                    { return x % 2 == 0; })
+            .map([](long long x)
+                 { return x + 1; })
+            .filter([](long long x)
+                    { return x % 5 != 0; })
+            .take(n / 4)
+            .collect()
+            .size();
+    };
+}
+
+TEST_CASE("List parallel algorithms with large inputs", "[large]")
+{
+    const int n = 1'000'000;
+
+    List<Int> ints;
+    for (int i = 0; i < n; ++i)
+    {
+        ints += Int(i) * Int("1000000000000000000");
+    }
+
+    BENCHMARK("map List<Int> 10^6")
+    {
+        return List<Int>(ints).map([](Int& x)
+                                   { x *= x; })
+            .size();
+    };
+    BENCHMARK("par_map List<Int> 10^6")
+    {
+        return List<Int>(ints).par_map([](Int& x)
+                                       { x *= x; })
+            .size();
+    };
+    BENCHMARK("filter List<Int> 10^6")
+    {
+        return List<Int>(ints).filter([](const Int& x)
+                                      { return x.is_even(); })
+            .size();
+    };
+    BENCHMARK("par_filter List<Int> 10^6")
+    {
+        return List<Int>(ints).par_filter([](const Int& x)
+                                          { return x.is_even(); })
+            .size();
+    };
+    BENCHMARK("par_reduce List<Int> 10^6")
+    {
+        return ints.par_reduce(std::plus<>());
+    };
+}
+
+TEST_CASE("SmallList with large inputs", "[large]")
+{
+    const int n = 100'000;
+
+    // lines of six fields, like the records of a CSV file
+    List<Str> lines;
+    for (int i = 0; i < n; ++i)
+    {
+        lines += Str(std::to_string(i)) + ",name,42,3.14,true,end";
+    }
+
+    // parse the fields of each line into a list made by `make`, and use it once, `inspect` sees the lists
+    auto parse = [&](auto make, auto inspect)
+    {
+        std::size_t total = 0;
+        for (const auto& line : lines)
+        {
+            auto fields = make();
+            for (const auto& field : StrView(line).split(","))
+            {
+                fields += field;
+            }
+            auto middle = (fields >>= 1).slice(1, -1);
+            inspect(fields);
+            inspect(middle);
+            total += middle[0].size();
+        }
+        return total;
+    };
+    auto ignore = [](const auto&) {};
+
+    // the allocations of the lists only: List allocates from the counting resource,
+    // and SmallList allocates when its elements are not inside the object
+    CountingResource resource;
+    parse([&]
+          { return pmr::List<StrView>(&resource); }, ignore);
+    const std::size_t list_allocations = resource.count() / n;
+
+    std::size_t spills = 0;
+    parse([]
+          { return SmallList<StrView, 8>(); }, [&](const auto& list)
+          {
+              const auto* object = reinterpret_cast<const char*>(&list);
+              const auto* elements = reinterpret_cast<const char*>(&*list.begin());
+              spills += std::less<>()(elements, object) || !std::less<>()(elements, object + sizeof(list));
+          });
+    const std::size_t small_allocations = spills / n;
+
+    REQUIRE(small_allocations + 4 <= list_allocations); // the fields list grows 4 times, and the slice allocates once
+    WARN("allocations per line: List " << list_allocations << ", SmallList " << small_allocations);
+
+    BENCHMARK("parse fields List<StrView> 10^5")
+    {
+        return parse([]
+                     { return List<StrView>(); }, ignore);
+    };
+    BENCHMARK("parse fields SmallList<StrView, 8> 10^5")
+    {
+        return parse([]
+                     { return SmallList<StrView, 8>(); }, ignore);
+    };
+}
+
+TEST_CASE("GapList with large inputs", "[large]")
+{
+    const int n = 100'000;
+
+    // insert and remove around a cursor which wanders through the list, like an editor
+    auto edit = [&]<typename L>(L list)
+    {
+        std::mt19937 gen(233);
+        int cursor = n / 2;
+        for (int i = 0; i < n; ++i)
+        {
+            cursor = std::clamp(cursor + std::uniform_int_distribution<int>(-8, 8)(gen), 0, list.size() - 1);
+            if (i % 3 == 2)
+            {
+                list.remove(cursor);
+            }
+            else
+            {
+                list.insert(cursor, i);
+            }
+        }
+        return list.size();
+    };
+
+    std::vector<int> init(n);
+    std::iota(init.begin(), init.end(), 0);
+    BENCHMARK("List edit near a cursor 10^5")
+    {
+        return edit(List<int>(init.begin(), init.end()));
+    };
+    BENCHMARK("GapList edit near a cursor 10^5")
+    {
+        return edit(GapList<int>(init.begin(), init.end()));
+    };
+}
+
+TEST_CASE("List and Deque rotation with large inputs", "[large]")
+{
+    const int n = 1'000'000;
+    const int rounds = 1'000;
+
+    // slide a window over a ring buffer: rotate by a small amount and read a few elements each round
+    auto slide = [&](auto& ring, auto rotate)
+    {
+        long long sum = 0;
+        for (int i = 0; i < rounds; ++i)
+        {
+            rotate(ring, i % 7 + 1);
+            sum += ring[0] + ring[n / 2] + ring[n - 1];
+        }
+        return sum;
+    };
+
+    std::vector<int> init(n);
+    std::iota(init.begin(), init.end(), 0);
+    BENCHMARK("std::vector std::rotate 10^6")
+    {
+        std::vector<int> vector(init);
+        return slide(vector, [](std::vector<int>& v, int k)
+                     { std::rotate(v.begin(), v.begin() + k, v.end()); });
+    };
+    BENCHMARK("List rotate 10^6")
+    {
+        List<int> list(init);
+        return slide(list, [](List<int>& l, int k)
+                     { l <<= k; });
+    };
+    BENCHMARK("RingList rotate 10^6")
+    {
+        RingList<int> list(init);
+        return slide(list, [](RingList<int>& l, int k)
+                     { l <<= k; });
+    };
+    BENCHMARK("std::deque std::rotate 10^6")
+    {
+        std::deque<int> deque(init.begin(), init.end());
+        return slide(deque, [](std::deque<int>& d, int k)
+                     { std::rotate(d.begin(), d.begin() + k, d.end()); });
+    };
+    BENCHMARK("Deque rotate 10^6")
+    {
+        Deque<int> deque(init.begin(), init.end());
+        return slide(deque, [](Deque<int>& d, int k)
+                     { d <<= k; });
+    };
+    BENCHMARK("RingDeque rotate 10^6")
+    {
+        RingDeque<int> deque(init.begin(), init.end());
+        return slide(deque, [](RingDeque<int>& d, int k)
+                     { d <<= k; });
+    };
+}
+
+TEST_CASE("Rope with large inputs", "[large]")
+{
+    const int n = 10'000;
+
+    // insert 100 chars into the middle of the document n times, the document grows to 1 MB
+    const std::string line(99, 'x');
+    BENCHMARK("Str insert in the middle 10^4")
+    {
+        Str doc = "\n";
+        for (int i = 0; i < n; ++i)
+        {
+            doc = doc.slice(0, doc.size() / 2) + Str(line) + Str("\n") + doc.slice(doc.size() / 2, doc.size());
+        }
+        return doc.size();
+    };
+    BENCHMARK("Rope insert in the middle 10^4")
+    {
+        Rope doc = "\n";
+        for (int i = 0; i < n; ++i)
+        {
+            doc = doc.insert(doc.size() / 2, line + "\n");
+        }
+        return doc.size();
+    };
+}
+
+/*
+Run with: `xmake config -m release && xmake build bench && xmake run bench --benchmark-no-analysis -i [large]`
+*/
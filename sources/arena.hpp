@@ -0,0 +1,175 @@
+//! @file arena.hpp
+//! @author Chen QingYu <chen_qingyu@qq.com>
+//! @brief Arena class.
+//! @date 2026.10.16
+
+#ifndef ARENA_HPP
+#define ARENA_HPP
+
+#include "detail.hpp"
+
+namespace pyincpp
+{
+
+/// Arena is a memory resource which allocates by bumping a pointer through large blocks, and frees everything at once by `reset()`.
+/// It suits the short-lived data structures of a request: create them in the arena with the `pmr` containers, and reset it after the request.
+/// Deallocation does nothing, the memory is reused only after `reset()`. An arena must outlive its containers, and is not thread-safe.
+///
+/// ### Example
+/// ```
+/// Arena arena;
+/// pmr::Dict<pmr::Str, pmr::List<Int>> dict(&arena); // the nodes, keys, lists and integers are all allocated in the arena
+/// dict.add("primes", {2, 3, 5, 7});
+/// ...
+/// dict.clear();
+/// arena.reset(); // ready for the next request
+/// ```
+class Arena : public std::pmr::memory_resource
+{
+private:
+    // Header at the start of each block.
+    struct Block
+    {
+        Block* next;
+        std::size_t size;
+    };
+
+    // Resource to allocate the blocks from.
+    std::pmr::memory_resource* upstream_;
+
+    // Blocks, the current one first.
+    Block* blocks_ = nullptr;
+
+    // Free space of the current block.
+    char* cursor_ = nullptr;
+    char* limit_ = nullptr;
+
+    // Size of the next block.
+    std::size_t next_size_;
+
+    // Number of bytes allocated since the last reset.
+    std::size_t used_ = 0;
+
+    // Allocate a block which can hold at least `bytes` aligned by `alignment`, and make it current.
+    void grow(std::size_t bytes, std::size_t alignment)
+    {
+        const std::size_t size = std::max(next_size_, sizeof(Block) + bytes + alignment);
+        auto block = static_cast<Block*>(upstream_->allocate(size, alignof(std::max_align_t)));
+        blocks_ = new (block) Block{blocks_, size};
+        cursor_ = reinterpret_cast<char*>(block + 1);
+        limit_ = reinterpret_cast<char*>(block) + size;
+        next_size_ = size * 2;
+    }
+
+    // Return the blocks to the upstream resource.
+    void release()
+    {
+        while (blocks_)
+        {
+            Block* next = blocks_->next;
+            upstream_->deallocate(blocks_, blocks_->size, alignof(std::max_align_t));
+            blocks_ = next;
+        }
+        cursor_ = limit_ = nullptr;
+    }
+
+    // Allocate `bytes` aligned by `alignment` from the current block, or from a new block if it has no room.
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override
+    {
+        void* p = cursor_;
+        std::size_t space = limit_ - cursor_;
+        if (!cursor_ || !std::align(alignment, bytes, p, space))
+        {
+            grow(bytes, alignment);
+            p = cursor_;
+            space = limit_ - cursor_;
+            std::align(alignment, bytes, p, space);
+        }
+
+        cursor_ = static_cast<char*>(p) + bytes;
+        used_ += bytes;
+        return p;
+    }
+
+    // Do nothing, the memory is freed by `reset()`.
+    void do_deallocate(void*, std::size_t, std::size_t) override
+    {
+    }
+
+    // Memory of an arena can only be deallocated by itself.
+    bool do_is_equal(const std::pmr::memory_resource& that) const noexcept override
+    {
+        return this == &that;
+    }
+
+public:
+    /*
+     * Constructor / Destructor
+     */
+
+    /// Create an arena whose first block has `block_size` bytes, and the later blocks grow geometrically.
+    /// The blocks are allocated from the `upstream` resource (the default resource by default).
+    explicit Arena(std::size_t block_size = 4096, std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
+        : upstream_(upstream)
+        , next_size_(std::max(block_size, 2 * sizeof(Block)))
+    {
+    }
+
+    Arena(const Arena&) = delete;
+
+    Arena& operator=(const Arena&) = delete;
+
+    /// Return all the memory to the upstream resource.
+    ~Arena()
+    {
+        release();
+    }
+
+    /*
+     * Examination
+     */
+
+    /// Return the number of bytes allocated from the arena since the last reset.
+    std::size_t used() const
+    {
+        return used_;
+    }
+
+    /// Return the number of bytes of the blocks held by the arena.
+    std::size_t capacity() const
+    {
+        std::size_t total = 0;
+        for (Block* block = blocks_; block; block = block->next)
+        {
+            total += block->size;
+        }
+        return total;
+    }
+
+    /*
+     * Manipulation
+     */
+
+    /// Free all the memory allocated from the arena at once, and keep the blocks for reuse.
+    /// If the arena has grown to several blocks, they are merged into one, so a request of the same size next time fits in it.
+    /// All the containers allocated from the arena must be destroyed or cleared before.
+    void reset()
+    {
+        if (blocks_ && blocks_->next)
+        {
+            const std::size_t size = capacity();
+            release();
+            next_size_ = size;
+            grow(0, 1);
+        }
+        else if (blocks_)
+        {
+            cursor_ = reinterpret_cast<char*>(blocks_ + 1);
+        }
+        used_ = 0;
+    }
+};
+
+} // namespace pyincpp
+
+#endif // ARENA_HPP
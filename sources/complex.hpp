@@ -270,7 +270,10 @@ struct std::hash<pyincpp::Complex> // explicit specialization
 {
     std::size_t operator()(const pyincpp::Complex& complex) const
     {
-        return std::hash<double>{}(complex.real()) ^ (std::hash<double>{}(complex.imag()) << 1);
+        // +0.0 and -0.0 are equal, so they must have the same hash value
+        const std::uint64_t real = std::bit_cast<std::uint64_t>(complex.real() + 0.0);
+        const std::uint64_t imag = std::bit_cast<std::uint64_t>(complex.imag() + 0.0);
+        return pyincpp::detail::hash_mix(real ^ pyincpp::detail::hash_seed() ^ pyincpp::detail::HASH_SECRET[0], imag ^ pyincpp::detail::HASH_SECRET[1]);
     }
 };
 
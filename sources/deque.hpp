@@ -14,37 +14,113 @@ namespace pyincpp
 {
 
 /// Deque is generalization of stack and queue, supports memory efficient pushes and pops from either side.
-template <typename T>
+/// The memory is allocated by `Allocator` (std::allocator if void), see `pmr::Deque` for deques in an `Arena`.
+/// If `Ring` is `true`, the deque is rotated in O(1) time by a start offset over its storage, see `RingDeque`.
+template <typename T, typename Allocator = void, bool Ring = false>
 class Deque
 {
 private:
-    // Deque.
-    std::deque<T> deque_;
+    // Storage of the elements.
+    using Storage = std::deque<T, detail::allocator_of<T, Allocator>>;
+
+    // Deque, the elements of a RingDeque are rotated lazily over it as a ring, see `materialize()`.
+    Storage deque_;
+
+    // Start offset of the lazy rotations, always 0 and empty unless `Ring`.
+    [[no_unique_address]] detail::OffsetOf<Ring> offset_;
+
+    // Move the elements to their logical positions after the lazy rotations, so that the deque is in order.
+    // The elements before the start are moved from the front to the back, or the others from the back to the front,
+    // so it takes O(min(K, N - K)) time for a rotation of K elements. The non-const members which modify the deque call it first.
+    void materialize()
+    {
+        if (offset_.start == 0)
+        {
+            return;
+        }
+
+        if (offset_.start <= deque_.size() / 2)
+        {
+            for (std::size_t i = 0; i < offset_.start; ++i)
+            {
+                deque_.push_back(std::move(deque_.front()));
+                deque_.pop_front();
+            }
+        }
+        else
+        {
+            for (std::size_t i = offset_.start; i < deque_.size(); ++i)
+            {
+                deque_.push_front(std::move(deque_.back()));
+                deque_.pop_back();
+            }
+        }
+        offset_ = {};
+    }
+
+    // Return `f(first, last)` with the iterators to the elements in order: of the deque if it is not rotated, or ring iterators otherwise.
+    template <typename F>
+    decltype(auto) with_range(const F& f) const
+    {
+        if constexpr (Ring)
+        {
+            if (offset_.start != 0)
+            {
+                return f(begin(), end());
+            }
+        }
+
+        return f(deque_.begin(), deque_.end());
+    }
 
 public:
     /*
      * Constructor
      */
 
+    /// Type of the allocator.
+    /// The containers with a polymorphic allocator pass their memory resource on to the `pmr::Deque` elements.
+    using allocator_type = detail::allocator_of<T, Allocator>;
+
     /// Create an empty deque.
     Deque() = default;
 
+    /// Create an empty deque which allocates by the `allocator`, like `pmr::Deque<int>(&arena)`.
+    explicit Deque(const allocator_type& allocator)
+        : deque_(allocator)
+    {
+    }
+
     /// Create a deque with the contents of the initializer list `init`.
-    Deque(const std::initializer_list<T>& init)
-        : deque_(init)
+    Deque(const std::initializer_list<T>& init, const allocator_type& allocator = allocator_type())
+        : deque_(init, allocator)
     {
     }
 
     /// Create a deque with the contents of the range [`first`, `last`).
     template <std::input_iterator InputIt>
-    Deque(const InputIt& first, const InputIt& last)
-        : deque_(first, last)
+    Deque(const InputIt& first, const InputIt& last, const allocator_type& allocator = allocator_type())
+        : deque_(first, last, allocator)
     {
     }
 
     /// Create a deque from std::deque.
-    Deque(const std::deque<T>& deque)
-        : deque_(deque)
+    Deque(const std::deque<T>& deque, const allocator_type& allocator = allocator_type())
+        : deque_(deque.begin(), deque.end(), allocator)
+    {
+    }
+
+    /// Create a copy of the deque which allocates by the `allocator`.
+    Deque(const Deque& that, const allocator_type& allocator)
+        : deque_(that.deque_, allocator)
+        , offset_(that.offset_)
+    {
+    }
+
+    /// Move the deque into one which allocates by the `allocator`, the elements are moved one by one if the allocators differ.
+    Deque(Deque&& that, const allocator_type& allocator)
+        : deque_(std::move(that.deque_), allocator)
+        , offset_(std::move(that.offset_))
     {
     }
 
@@ -52,35 +128,63 @@ public:
      * Comparison
      */
 
+    /// Check whether two deques are equal.
+    bool operator==(const Deque& that) const
+    {
+        return with_range([&](auto first1, auto last1)
+                          { return that.with_range([&](auto first2, auto last2)
+                                                   { return std::equal(first1, last1, first2, last2); }); });
+    }
+
     /// Compare the deque with another deque.
-    auto operator<=>(const Deque& that) const = default;
+    auto operator<=>(const Deque& that) const
+    {
+        return with_range([&](auto first1, auto last1)
+                          { return that.with_range([&](auto first2, auto last2)
+                                                   { return std::lexicographical_compare_three_way(first1, last1, first2, last2, detail::synth_three_way<T>); }); });
+    }
 
     /*
      * Iterator
      */
 
     /// Return an iterator to the first element of the deque.
+    /// The iterators of a RingDeque map the index through the start offset of the lazy rotations, see `RingDeque`.
     auto begin() const
     {
-        return deque_.begin();
+        if constexpr (Ring)
+        {
+            return detail::RingIterator<Storage>(deque_, offset_.start, 0);
+        }
+        else
+        {
+            return deque_.begin();
+        }
     }
 
     /// Return an iterator to the element following the last element of the deque.
     auto end() const
     {
-        return deque_.end();
+        if constexpr (Ring)
+        {
+            return detail::RingIterator<Storage>(deque_, offset_.start, deque_.size());
+        }
+        else
+        {
+            return deque_.end();
+        }
     }
 
     /// Return a reverse iterator to the first element of the reversed deque.
     auto rbegin() const
     {
-        return deque_.rbegin();
+        return std::make_reverse_iterator(end());
     }
 
     /// Return a reverse iterator to the element following the last element of the reversed deque.
     auto rend() const
     {
-        return deque_.rend();
+        return std::make_reverse_iterator(begin());
     }
 
     /*
@@ -92,7 +196,7 @@ public:
     {
         detail::check_empty(size());
 
-        return deque_.back();
+        return deque_[offset_.position(size() - 1, size())];
     }
 
     /// Peek the last element.
@@ -106,7 +210,7 @@ public:
     {
         detail::check_empty(size());
 
-        return deque_.front();
+        return deque_[offset_.start];
     }
 
     /// Peek the first element.
@@ -120,7 +224,7 @@ public:
     {
         detail::check_bounds(index, -size(), size());
 
-        return index >= 0 ? deque_[index] : deque_[index + size()];
+        return deque_[offset_.position(index >= 0 ? index : index + size(), size())];
     }
 
     /// Return a const reference to the element at specified `index`.
@@ -145,6 +249,12 @@ public:
         return deque_.empty();
     }
 
+    /// Return the allocator of the deque.
+    allocator_type get_allocator() const
+    {
+        return deque_.get_allocator();
+    }
+
     /*
      * Manipulation
      */
@@ -152,17 +262,57 @@ public:
     /// Append the given `element` to the end of the deque.
     void push_back(const T& element)
     {
-        detail::check_full(size(), INT_MAX);
+        emplace_back(element);
+    }
 
-        deque_.push_back(element);
+    /// Append the given `element` to the end of the deque, moving it.
+    void push_back(T&& element)
+    {
+        emplace_back(std::move(element));
     }
 
     /// Prepend the given `element` to the beginning of the deque.
     void push_front(const T& element)
+    {
+        emplace_front(element);
+    }
+
+    /// Prepend the given `element` to the beginning of the deque, moving it.
+    void push_front(T&& element)
+    {
+        emplace_front(std::move(element));
+    }
+
+    /// Append an element constructed in place from `args` to the end of the deque, and return a reference to it.
+    template <typename... Args>
+    T& emplace_back(Args&&... args)
     {
         detail::check_full(size(), INT_MAX);
 
-        deque_.push_front(element);
+        if (offset_.start != 0)
+        {
+            // construct the element before the rotation moves the elements, since `args` may refer to one of them
+            T element(std::forward<Args>(args)...);
+            materialize();
+            return deque_.emplace_back(std::move(element));
+        }
+        return deque_.emplace_back(std::forward<Args>(args)...);
+    }
+
+    /// Prepend an element constructed in place from `args` to the beginning of the deque, and return a reference to it.
+    template <typename... Args>
+    T& emplace_front(Args&&... args)
+    {
+        detail::check_full(size(), INT_MAX);
+
+        if (offset_.start != 0)
+        {
+            // construct the element before the rotation moves the elements, since `args` may refer to one of them
+            T element(std::forward<Args>(args)...);
+            materialize();
+            return deque_.emplace_front(std::move(element));
+        }
+        return deque_.emplace_front(std::forward<Args>(args)...);
     }
 
     /// Remove and return the last element of the deque.
@@ -171,6 +321,7 @@ public:
     {
         detail::check_empty(size());
 
+        materialize();
         T data = std::move(deque_.back());
         deque_.pop_back();
         return data;
@@ -182,6 +333,7 @@ public:
     {
         detail::check_empty(size());
 
+        materialize();
         T data = std::move(deque_.front());
         deque_.pop_front();
         return data;
@@ -191,6 +343,7 @@ public:
     template <std::input_iterator InputIt>
     void extend_back(const InputIt& first, const InputIt& last)
     {
+        materialize();
         deque_.insert(deque_.end(), first, last);
     }
 
@@ -198,10 +351,12 @@ public:
     template <std::input_iterator InputIt>
     void extend_front(const InputIt& first, const InputIt& last)
     {
+        materialize();
         deque_.insert(deque_.begin(), first, last);
     }
 
     /// Rotate `n` elements to the right.
+    /// It takes O(N) time, or O(1) time for a RingDeque, see `RingDeque`.
     Deque& operator>>=(int n)
     {
         if (size() <= 1 || n == 0)
@@ -218,6 +373,7 @@ public:
     }
 
     /// Rotate `n` elements to the left.
+    /// It takes O(N) time, or O(1) time for a RingDeque, see `RingDeque`.
     Deque& operator<<=(int n)
     {
         if (size() <= 1 || n == 0)
@@ -232,7 +388,14 @@ public:
             n += size();
         }
 
-        std::rotate(deque_.begin(), deque_.begin() + n, deque_.end());
+        if constexpr (Ring)
+        {
+            offset_.rotate(n, size());
+        }
+        else
+        {
+            std::rotate(deque_.begin(), deque_.begin() + n, deque_.end());
+        }
 
         return *this;
     }
@@ -240,6 +403,7 @@ public:
     /// Reverse the deque in place.
     Deque& reverse()
     {
+        materialize();
         std::reverse(deque_.begin(), deque_.end());
 
         return *this;
@@ -249,6 +413,7 @@ public:
     void clear()
     {
         deque_.clear();
+        offset_ = {};
     }
 
     /*
@@ -258,10 +423,34 @@ public:
     /// Output the deque to the specified output stream.
     friend std::ostream& operator<<(std::ostream& os, const Deque& deque)
     {
-        return detail::print(os, deque.begin(), deque.end(), '<', '>');
+        return deque.with_range([&](auto first, auto last) -> std::ostream&
+                                { return detail::print(os, first, last, '<', '>'); });
     }
 };
 
+/// RingDeque is a Deque which is rotated in O(1) time: it keeps a start offset over its storage, and indexing stays O(1).
+/// The const members read the elements in place, through ring iterators after rotations, and the elements are moved only when
+/// the deque is modified after rotations, in O(min(K, N - K)) time for a rotation of K elements.
+///
+/// ### Example
+/// ```
+/// RingDeque<int> ring = {1, 2, 3, 4, 5};
+/// ring >>= 1; // O(1), nothing is moved
+/// ring.front(); // 5
+/// ring.push_back(6); // one element is moved: <5, 1, 2, 3, 4, 6>
+/// ```
+template <typename T, typename Allocator = void>
+using RingDeque = Deque<T, Allocator, true>;
+
+namespace pmr
+{
+
+/// Deque which allocates from a memory resource, like an `Arena`, and passes it on to the elements which are allocator-aware.
+template <typename T>
+using Deque = pyincpp::Deque<T, std::pmr::polymorphic_allocator<T>>;
+
+} // namespace pmr
+
 } // namespace pyincpp
 
 #endif // DEQUE_HPP
@@ -6,32 +6,61 @@
 #ifndef DETAIL_HPP
 #define DETAIL_HPP
 
-#include <algorithm>   // std::copy std::find std::rotate ...
-#include <cassert>     // assert
-#include <climits>     // INT_MAX
-#include <cmath>       // std::abs std::pow std::sqrt ...
-#include <concepts>    // std::integral
-#include <cstring>     // std::strlen
-#include <iomanip>     // std::setw std::setfill
-#include <istream>     // std::istream
-#include <iterator>    // std::input_iterator
-#include <limits>      // std::numeric_limits
-#include <numeric>     // std::gcd
-#include <ostream>     // std::ostream
-#include <random>      // std::random_device std::mt19937 ...
-#include <ranges>      // std::views::reverse
-#include <sstream>     // std::ostringstream
-#include <stdexcept>   // std::runtime_error
-#include <string>      // std::string std::getline
-#include <string_view> // std::string_view
-#include <utility>     // std::initializer_list std::move
-#include <vector>      // std::vector
+#include <algorithm>       // std::copy std::find std::rotate ...
+#include <array>           // std::array
+#include <atomic>          // std::atomic
+#include <bit>             // std::endian std::popcount ...
+#include <cassert>         // assert
+#include <charconv>        // std::from_chars std::to_chars
+#include <climits>         // INT_MAX
+#include <cmath>           // std::abs std::pow std::sqrt ...
+#include <compare>         // std::strong_ordering std::weak_ordering
+#include <concepts>        // std::integral
+#include <cstdint>         // std::uint64_t
+#include <cstring>         // std::strlen std::memcpy
+#include <deque>           // std::deque
+#include <exception>       // std::exception_ptr
+#include <fstream>         // std::ifstream
+#include <functional>      // std::function std::less std::invoke
+#include <iomanip>         // std::setw std::setfill
+#include <istream>         // std::istream
+#include <iterator>        // std::input_iterator
+#include <limits>          // std::numeric_limits
+#include <memory>          // std::shared_ptr
+#include <memory_resource> // std::pmr::memory_resource std::pmr::polymorphic_allocator
+#include <mutex>           // std::unique_lock
+#include <numeric>         // std::gcd std::iota
+#include <optional>        // std::optional
+#include <ostream>         // std::ostream
+#include <random>          // std::random_device std::mt19937 ...
+#include <ranges>          // std::views::reverse
+#include <semaphore>       // std::counting_semaphore
+#include <shared_mutex>    // std::shared_mutex std::shared_lock
+#include <sstream>         // std::ostringstream
+#include <stdexcept>       // std::runtime_error
+#include <string>          // std::string std::getline
+#include <string_view>     // std::string_view
+#include <thread>          // std::thread::hardware_concurrency
+#include <unordered_map>   // std::unordered_map
+#include <utility>         // std::initializer_list std::move
+#include <vector>          // std::vector
+
+// Let the compiler generate an AVX2 clone of hot loops in addition to the default one,
+// the best one is selected at runtime when the program is loaded (needs ifunc of glibc).
+#if defined(__GNUC__) && defined(__x86_64__) && defined(__GLIBC__) && defined(__has_attribute)
+#if __has_attribute(target_clones)
+#define PYINCPP_TARGET_CLONES __attribute__((target_clones("avx2", "default")))
+#endif
+#endif
+#ifndef PYINCPP_TARGET_CLONES
+#define PYINCPP_TARGET_CLONES
+#endif
 
 namespace pyincpp::detail
 {
 
-// Check whether the index is valid (begin <= pos < end).
-static inline void check_bounds(int pos, int begin, int end)
+// Check whether the index is valid (begin <= pos < end), for the int indices of the containers and the std::ptrdiff_t ones of StrView.
+static inline void check_bounds(long long pos, long long begin, long long end)
 {
     if (pos < begin || pos >= end)
     {
@@ -67,6 +96,33 @@ static inline void check_zero(T number)
     }
 }
 
+// Whether a `Key` can be looked up in an ordered container of `K` without constructing a `K` (heterogeneous lookup).
+// Only string-like keys are allowed, since for others (like int for Int) converting once is cheaper than every comparison.
+template <typename Key, typename K>
+concept transparent_key = !std::is_same_v<Key, K> && std::is_convertible_v<const Key&, std::string_view> && requires(const K& k, const Key& key) { k < key; key < k; };
+
+// Whether `std::hash<T>` is available for `T`.
+template <typename T>
+concept hashable = requires(const T& t) { { std::hash<T>()(t) } -> std::convertible_to<std::size_t>; };
+
+// Whether `T` has `operator<` to sort.
+template <typename T>
+concept less_comparable = requires(const T& a, const T& b) { { a < b } -> std::convertible_to<bool>; };
+
+// Compare two elements by `<=>` if available or by `<` otherwise, like the lexicographical comparison of std::vector.
+template <typename T>
+static inline auto synth_three_way(const T& a, const T& b)
+{
+    if constexpr (std::three_way_comparable<T>)
+    {
+        return a <=> b;
+    }
+    else
+    {
+        return a < b ? std::weak_ordering::less : b < a ? std::weak_ordering::greater : std::weak_ordering::equivalent;
+    }
+}
+
 // Print helper for Pair.
 // This function can only be placed here because of the header file reference order.
 template <typename K, typename V>
@@ -102,6 +158,1529 @@ static inline std::ostream& print(std::ostream& os, const InputIt& first, const
     }
 }
 
+// Test whether the 8 chars starting at `p` are all decimal digits, using SWAR.
+static inline bool is_eight_digits(const char* p)
+{
+    std::uint64_t v;
+    std::memcpy(&v, p, 8);
+    return (((v & 0xF0F0F0F0F0F0F0F0) | (((v + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) >> 4)) == 0x3333333333333333);
+}
+
+// Parse the 8 decimal digits starting at `p` into an integer, using SWAR.
+// See: https://lemire.me/blog/2022/01/21/swar-explained-parsing-eight-digits
+static inline std::uint32_t parse_eight_digits(const char* p)
+{
+    std::uint64_t v;
+    std::memcpy(&v, p, 8);
+    if constexpr (std::endian::native == std::endian::big)
+    {
+        v = ((v & 0x00000000FFFFFFFF) << 32) | ((v & 0xFFFFFFFF00000000) >> 32);
+        v = ((v & 0x0000FFFF0000FFFF) << 16) | ((v & 0xFFFF0000FFFF0000) >> 16);
+        v = ((v & 0x00FF00FF00FF00FF) << 8) | ((v & 0xFF00FF00FF00FF00) >> 8);
+    }
+    v -= 0x3030303030303030;
+    v = (v * 10) + (v >> 8);
+    v = (((v & 0x000000FF000000FF) * 0x000F424000000064) + (((v >> 16) & 0x000000FF000000FF) * 0x0000271000000001)) >> 32;
+    return std::uint32_t(v);
+}
+
+/*
+ * ASCII kernels
+ *
+ * Process 8 chars at a time in a 64-bit word (SWAR), and the remaining chars one by one.
+ */
+
+// Load 8 chars as a word.
+static inline std::uint64_t load_word(const char* p)
+{
+    std::uint64_t v;
+    std::memcpy(&v, p, 8);
+    return v;
+}
+
+// Broadcast the char to all bytes of a word.
+static inline constexpr std::uint64_t broadcast(unsigned char c)
+{
+    return 0x0101010101010101ull * c;
+}
+
+// Set the high bit of each byte of `v` that is in range [`lo`, `hi`] (`hi` <= 0x7F), other bits are cleared.
+static inline std::uint64_t in_range(std::uint64_t v, unsigned char lo, unsigned char hi)
+{
+    const std::uint64_t t = v & broadcast(0x7F);
+    return (t + broadcast(0x80 - lo)) & ~(t + broadcast(0x7F - hi)) & ~v & broadcast(0x80);
+}
+
+// Index of the first (lowest address) byte which has the high bit set in a non-zero mask.
+static inline int first_byte(std::uint64_t mask)
+{
+    return (std::endian::native == std::endian::little ? std::countr_zero(mask) : std::countl_zero(mask)) / 8;
+}
+
+// Index of the last (highest address) byte which has the high bit set in a non-zero mask.
+static inline int last_byte(std::uint64_t mask)
+{
+    return 7 - (std::endian::native == std::endian::little ? std::countl_zero(mask) : std::countr_zero(mask)) / 8;
+}
+
+// Test whether the char is in range [`lo`, `hi`].
+static inline bool in_range(char c, unsigned char lo, unsigned char hi)
+{
+    return static_cast<unsigned char>(c) >= lo && static_cast<unsigned char>(c) <= hi;
+}
+
+// Copy `n` chars from `src` to `dest`, and flip the case of chars in range [`lo`, `hi`] (letters only).
+PYINCPP_TARGET_CLONES static inline void ascii_flip_case(const char* src, char* dest, std::size_t n, unsigned char lo, unsigned char hi)
+{
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        std::uint64_t v = load_word(src + i);
+        v ^= in_range(v, lo, hi) >> 2; // 0x80 >> 2 == 0x20, the case bit
+        std::memcpy(dest + i, &v, 8);
+    }
+    for (; i < n; ++i)
+    {
+        dest[i] = in_range(src[i], lo, hi) ? src[i] ^ 0x20 : src[i];
+    }
+}
+
+// Count the chars in range [`lo`, `hi`] (`hi` <= 0x7F).
+PYINCPP_TARGET_CLONES static inline std::size_t ascii_count(const char* p, std::size_t n, unsigned char lo, unsigned char hi)
+{
+    std::size_t cnt = 0;
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        cnt += std::popcount(in_range(load_word(p + i), lo, hi));
+    }
+    for (; i < n; ++i)
+    {
+        cnt += in_range(p[i], lo, hi);
+    }
+    return cnt;
+}
+
+// Return the index of the first char not in range [`lo`, `hi`], or `n` if there is none.
+PYINCPP_TARGET_CLONES static inline std::size_t ascii_span(const char* p, std::size_t n, unsigned char lo, unsigned char hi)
+{
+    std::size_t i = 0;
+    if (hi <= 0x7F)
+    {
+        for (; i + 8 <= n; i += 8)
+        {
+            if (std::uint64_t mask = ~in_range(load_word(p + i), lo, hi) & broadcast(0x80); mask != 0)
+            {
+                return i + first_byte(mask);
+            }
+        }
+    }
+    while (i < n && in_range(p[i], lo, hi))
+    {
+        ++i;
+    }
+    return i;
+}
+
+// Return the index past the last char not in range [`lo`, `hi`], or 0 if there is none.
+PYINCPP_TARGET_CLONES static inline std::size_t ascii_rspan(const char* p, std::size_t n, unsigned char lo, unsigned char hi)
+{
+    std::size_t i = n;
+    if (hi <= 0x7F)
+    {
+        for (; i >= 8; i -= 8)
+        {
+            if (std::uint64_t mask = ~in_range(load_word(p + i - 8), lo, hi) & broadcast(0x80); mask != 0)
+            {
+                return i - 8 + last_byte(mask) + 1;
+            }
+        }
+    }
+    while (i > 0 && in_range(p[i - 1], lo, hi))
+    {
+        --i;
+    }
+    return i;
+}
+
+// Convert the uppercase letters of a word to lowercase.
+static inline std::uint64_t ascii_fold(std::uint64_t v)
+{
+    return v | (in_range(v, 'A', 'Z') >> 2);
+}
+
+// Test whether the `n` chars of `p1` and `p2` are equal ignoring ASCII case.
+PYINCPP_TARGET_CLONES static inline bool ascii_casefold_equal(const char* p1, const char* p2, std::size_t n)
+{
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        const std::uint64_t a = load_word(p1 + i), b = load_word(p2 + i);
+        if (a != b && ascii_fold(a) != ascii_fold(b))
+        {
+            return false;
+        }
+    }
+    for (; i < n; ++i)
+    {
+        if ((in_range(p1[i], 'A', 'Z') ? p1[i] | 0x20 : p1[i]) != (in_range(p2[i], 'A', 'Z') ? p2[i] | 0x20 : p2[i]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Hash the `n` chars of `p` as if the ASCII uppercase letters were lowercase.
+PYINCPP_TARGET_CLONES static inline std::size_t ascii_casefold_hash(const char* p, std::size_t n)
+{
+    constexpr std::uint64_t k = 0x9E3779B97F4A7C15; // 2^64 / golden ratio
+
+    std::uint64_t h = n * k;
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        h = (h ^ ascii_fold(load_word(p + i))) * k;
+        h ^= h >> 32;
+    }
+    if (i < n)
+    {
+        std::uint64_t v = 0;
+        std::memcpy(&v, p + i, n - i);
+        h = (h ^ ascii_fold(v)) * k;
+        h ^= h >> 32;
+    }
+    return std::size_t(h);
+}
+
+/*
+ * UTF-8 kernels
+ *
+ * Skip 8 ASCII chars at a time in a 64-bit word (SWAR), and decode the others one by one.
+ */
+
+// Set the high bit of each byte of `v` that is a continuation byte (0b10xxxxxx), other bits are cleared.
+static inline std::uint64_t continuation_bytes(std::uint64_t v)
+{
+    return v & ~(v << 1) & broadcast(0x80);
+}
+
+// Decode the code point starting at `p` (before `last`) into `cp`, and return its length in bytes.
+// An invalid sequence (RFC 3629: overlong, surrogate, out of range or truncated) is decoded as U+FFFD of length 1.
+static inline int utf8_decode(const char* p, const char* last, char32_t& cp)
+{
+    const auto* s = reinterpret_cast<const unsigned char*>(p);
+    const std::ptrdiff_t n = last - p;
+    const unsigned char c = s[0];
+
+    // the range of the second byte depends on the first byte
+    int len = 0;
+    unsigned char lo = 0x80, hi = 0xBF;
+    if (c < 0x80)
+    {
+        cp = c;
+        return 1;
+    }
+    else if (c >= 0xC2 && c <= 0xDF)
+    {
+        len = 2;
+    }
+    else if (c >= 0xE0 && c <= 0xEF)
+    {
+        len = 3;
+        lo = c == 0xE0 ? 0xA0 : 0x80;
+        hi = c == 0xED ? 0x9F : 0xBF;
+    }
+    else if (c >= 0xF0 && c <= 0xF4)
+    {
+        len = 4;
+        lo = c == 0xF0 ? 0x90 : 0x80;
+        hi = c == 0xF4 ? 0x8F : 0xBF;
+    }
+
+    if (len == 0 || n < len || s[1] < lo || s[1] > hi || (len > 2 && (s[2] & 0xC0) != 0x80) || (len > 3 && (s[3] & 0xC0) != 0x80))
+    {
+        cp = 0xFFFD;
+        return 1;
+    }
+
+    cp = c & (0x7F >> len);
+    for (int i = 1; i < len; ++i)
+    {
+        cp = (cp << 6) | (s[i] & 0x3F);
+    }
+    return len;
+}
+
+// Test whether the `n` chars of `p` are valid UTF-8.
+PYINCPP_TARGET_CLONES static inline bool utf8_validate(const char* p, std::size_t n)
+{
+    const char* last = p + n;
+    while (p != last)
+    {
+        if (last - p >= 8 && (load_word(p) & broadcast(0x80)) == 0) // 8 ASCII chars
+        {
+            p += 8;
+            continue;
+        }
+
+        char32_t cp;
+        const int len = utf8_decode(p, last, cp);
+        if (len == 1 && cp == 0xFFFD)
+        {
+            return false;
+        }
+        p += len;
+    }
+    return true;
+}
+
+// Count the code points of the `n` chars of `p`, that is the number of bytes which are not continuation bytes.
+PYINCPP_TARGET_CLONES static inline std::size_t utf8_count(const char* p, std::size_t n)
+{
+    std::size_t cnt = n;
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        cnt -= std::popcount(continuation_bytes(load_word(p + i)));
+    }
+    for (; i < n; ++i)
+    {
+        cnt -= (static_cast<unsigned char>(p[i]) & 0xC0) == 0x80;
+    }
+    return cnt;
+}
+
+// Return the byte offset of the `k`-th code point of the `n` chars of `p`, or `n` if there are only `k` code points.
+static inline std::size_t utf8_offset(const char* p, std::size_t n, std::size_t k)
+{
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) // skip whole words while the k-th code point is not in them
+    {
+        const std::size_t cnt = 8 - std::popcount(continuation_bytes(load_word(p + i)));
+        if (cnt > k)
+        {
+            break;
+        }
+        k -= cnt;
+    }
+    for (; i < n; ++i)
+    {
+        if ((static_cast<unsigned char>(p[i]) & 0xC0) != 0x80 && k-- == 0)
+        {
+            return i;
+        }
+    }
+    return n;
+}
+
+// Forward iterator over the code points of UTF-8 chars, see `utf8_decode()`.
+class Utf8Iterator
+{
+private:
+    // Current position.
+    const char* p_ = nullptr;
+
+    // End of the chars.
+    const char* last_ = nullptr;
+
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = char32_t;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = char32_t;
+
+    Utf8Iterator() = default;
+
+    Utf8Iterator(const char* p, const char* last)
+        : p_(p)
+        , last_(last)
+    {
+    }
+
+    char32_t operator*() const
+    {
+        char32_t cp;
+        utf8_decode(p_, last_, cp);
+        return cp;
+    }
+
+    Utf8Iterator& operator++()
+    {
+        char32_t cp;
+        p_ += utf8_decode(p_, last_, cp);
+        return *this;
+    }
+
+    Utf8Iterator operator++(int)
+    {
+        Utf8Iterator it = *this;
+        ++*this;
+        return it;
+    }
+
+    bool operator==(const Utf8Iterator& that) const
+    {
+        return p_ == that.p_;
+    }
+};
+
+// Multiply two words into 128 bits, and return the low and high halves in `a` and `b`.
+static inline void mul128(std::uint64_t& a, std::uint64_t& b)
+{
+#ifdef __SIZEOF_INT128__
+    __extension__ typedef unsigned __int128 uint128;
+    const uint128 r = uint128(a) * b;
+    a = std::uint64_t(r);
+    b = std::uint64_t(r >> 64);
+#else
+    const std::uint64_t ha = a >> 32, hb = b >> 32, la = std::uint32_t(a), lb = std::uint32_t(b);
+    const std::uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+    const std::uint64_t t = rl + (rm0 << 32);
+    const std::uint64_t lo = t + (rm1 << 32);
+    const std::uint64_t carry = (t < rl) + (lo < t);
+    a = lo;
+    b = rh + (rm0 >> 32) + (rm1 >> 32) + carry;
+#endif
+}
+
+// Mix two words into one, the core of wyhash.
+static inline std::uint64_t hash_mix(std::uint64_t a, std::uint64_t b)
+{
+    mul128(a, b);
+    return a ^ b;
+}
+
+// Secrets of wyhash.
+inline constexpr std::uint64_t HASH_SECRET[4] = {0x2d358dccaa6c78a5, 0x8bb84b93962eacc9, 0x4b33a62ed433d4a3, 0x4d5a2da51de1aa47};
+
+// Seed of the hash functions of PyInCpp types.
+// It is 0 by default so that hash values are reproducible, define PYINCPP_RANDOM_HASH_SEED to pick a random seed
+// once per process against HashDoS. Not `static`, so that all translation units share the same seed.
+inline std::uint64_t hash_seed()
+{
+#ifdef PYINCPP_RANDOM_HASH_SEED
+    static const std::uint64_t seed = (std::uint64_t(std::random_device{}()) << 32) ^ std::random_device{}();
+    return seed;
+#else
+    return 0;
+#endif
+}
+
+// Hash a word.
+static inline std::uint64_t hash_word(std::uint64_t v, std::uint64_t seed = hash_seed())
+{
+    return hash_mix(v ^ seed ^ HASH_SECRET[0], HASH_SECRET[1]);
+}
+
+// Hash `n` bytes starting at `data`, using wyhash (final version 4).
+// See: https://github.com/wangyi-fudan/wyhash
+static inline std::uint64_t hash_bytes(const void* data, std::size_t n, std::uint64_t seed = hash_seed())
+{
+    const auto* p = static_cast<const unsigned char*>(data);
+    auto r4 = [](const unsigned char* q)
+    {
+        std::uint32_t v;
+        std::memcpy(&v, q, 4);
+        return std::uint64_t(v);
+    };
+    auto r8 = [](const unsigned char* q)
+    {
+        std::uint64_t v;
+        std::memcpy(&v, q, 8);
+        return v;
+    };
+
+    seed ^= hash_mix(seed ^ HASH_SECRET[0], HASH_SECRET[1]);
+
+    std::uint64_t a = 0, b = 0;
+    if (n <= 16)
+    {
+        if (n >= 4) // two overlapping pairs of 4 bytes
+        {
+            a = (r4(p) << 32) | r4(p + ((n >> 3) << 2));
+            b = (r4(p + n - 4) << 32) | r4(p + n - 4 - ((n >> 3) << 2));
+        }
+        else if (n > 0)
+        {
+            a = (std::uint64_t(p[0]) << 16) | (std::uint64_t(p[n >> 1]) << 8) | p[n - 1];
+        }
+    }
+    else
+    {
+        std::size_t i = n;
+        if (i > 48) // three independent lanes of 16 bytes
+        {
+            std::uint64_t see1 = seed, see2 = seed;
+            do
+            {
+                seed = hash_mix(r8(p) ^ HASH_SECRET[1], r8(p + 8) ^ seed);
+                see1 = hash_mix(r8(p + 16) ^ HASH_SECRET[2], r8(p + 24) ^ see1);
+                see2 = hash_mix(r8(p + 32) ^ HASH_SECRET[3], r8(p + 40) ^ see2);
+                p += 48;
+                i -= 48;
+            } while (i > 48);
+            seed ^= see1 ^ see2;
+        }
+        while (i > 16)
+        {
+            seed = hash_mix(r8(p) ^ HASH_SECRET[1], r8(p + 8) ^ seed);
+            p += 16;
+            i -= 16;
+        }
+        a = r8(p + i - 16); // the last 16 bytes, may overlap the processed ones
+        b = r8(p + i - 8);
+    }
+
+    a ^= HASH_SECRET[1];
+    b ^= seed;
+    mul128(a, b);
+
+    return hash_mix(a ^ HASH_SECRET[0] ^ n, b ^ HASH_SECRET[1]);
+}
+
+// Ranges shorter than this are not worth sorting in multiple threads.
+inline constexpr std::ptrdiff_t PARALLEL_THRESHOLD = 1 << 15;
+
+// Chunks of parallel algorithms have at least this many elements.
+inline constexpr std::size_t PARALLEL_CHUNK = 1 << 12;
+
+// Number of threads to use for parallel algorithms.
+static inline int parallel_threads()
+{
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+// Thread pool shared by the parallel algorithms, the calling thread works as well, so it has one thread less.
+class ThreadPool
+{
+private:
+    std::vector<std::thread> workers_;
+    std::deque<std::function<void()>> tasks_;
+    std::mutex mutex_;
+    std::counting_semaphore<> pending_{0}; // number of tasks, and a wake-up without task for each worker to stop
+
+    explicit ThreadPool(int threads)
+    {
+        for (int i = 0; i < threads; ++i)
+        {
+            workers_.emplace_back([this]()
+                                  { work(); });
+        }
+    }
+
+    void work()
+    {
+        while (true)
+        {
+            pending_.acquire();
+            std::function<void()> task;
+            {
+                std::lock_guard lock(mutex_);
+                if (tasks_.empty()) // stopped
+                {
+                    return;
+                }
+                task = std::move(tasks_.front());
+                tasks_.pop_front();
+            }
+            task();
+        }
+    }
+
+public:
+    ~ThreadPool()
+    {
+        pending_.release(workers_.size());
+        for (auto& worker : workers_)
+        {
+            worker.join();
+        }
+    }
+
+    static ThreadPool& instance()
+    {
+        static ThreadPool pool(parallel_threads() - 1);
+        return pool;
+    }
+
+    int size() const
+    {
+        return workers_.size();
+    }
+
+    void submit(std::function<void()> task)
+    {
+        {
+            std::lock_guard lock(mutex_);
+            tasks_.push_back(std::move(task));
+        }
+        pending_.release();
+    }
+};
+
+// Run `body(i)` for each i in [0, `count`) on the thread pool and the calling thread, and wait for all of them.
+// The calling thread takes the remaining work itself, so it never waits for a busy pool (such as when nested).
+// The first exception thrown by `body` is rethrown, and the remaining work is skipped.
+template <typename F>
+static void parallel_for(int count, const F& body)
+{
+    struct State
+    {
+        std::atomic<int> next = 0;
+        std::atomic<int> done = 0;
+        std::atomic<bool> failed = false;
+        std::mutex mutex;
+        std::exception_ptr error;
+    };
+    auto state = std::make_shared<State>();
+
+    // the workers only touch `body` when they take some work, which the calling thread waits for
+    auto run = [state, &body, count]()
+    {
+        int i = 0;
+        while ((i = state->next.fetch_add(1)) < count)
+        {
+            try
+            {
+                if (!state->failed.load(std::memory_order_relaxed))
+                {
+                    body(i);
+                }
+            }
+            catch (...)
+            {
+                std::lock_guard lock(state->mutex);
+                if (!state->error)
+                {
+                    state->error = std::current_exception();
+                }
+                state->failed = true;
+            }
+            if (state->done.fetch_add(1) + 1 == count)
+            {
+                state->done.notify_all();
+            }
+        }
+    };
+
+    const int helpers = std::min(ThreadPool::instance().size(), count - 1);
+    for (int i = 0; i < helpers; ++i)
+    {
+        ThreadPool::instance().submit(run);
+    }
+    run();
+
+    for (int done = 0; (done = state->done.load()) < count;)
+    {
+        state->done.wait(done);
+    }
+    if (state->error)
+    {
+        std::rethrow_exception(std::move(state->error)); // the state may be released by a worker later
+    }
+}
+
+// Chunks to process `n` elements in parallel: large enough to amortize the scheduling, and enough to balance the load.
+// The size is a multiple of 64, so that the chunks of std::vector<bool> do not share words between threads.
+struct ParallelChunks
+{
+    std::size_t n;
+    std::size_t size;
+    int count;
+
+    explicit ParallelChunks(std::size_t n)
+        : n(n)
+        , size((std::max(PARALLEL_CHUNK, n / (8 * parallel_threads()) + 1) + 63) / 64 * 64)
+        , count((n + size - 1) / size)
+    {
+    }
+
+    // Index of the first element of the chunk `c`.
+    std::size_t begin(int c) const
+    {
+        return c * size;
+    }
+
+    // Index following the last element of the chunk `c`.
+    std::size_t end(int c) const
+    {
+        return std::min(n, (c + 1) * size);
+    }
+};
+
+// Stable sort the range [`first`, `last`) by sorting its pieces in parallel and then merging them in parallel rounds.
+template <typename RandomIt, typename Compare>
+static void parallel_stable_sort(RandomIt first, RandomIt last, Compare comp)
+{
+    const std::ptrdiff_t n = last - first;
+    const int pieces = std::bit_floor(unsigned(std::min<std::ptrdiff_t>(parallel_threads(), n / PARALLEL_THRESHOLD + 1)));
+    if (pieces == 1)
+    {
+        std::stable_sort(first, last, comp);
+        return;
+    }
+
+    auto bound = [&](int i)
+    { return first + n * i / pieces; };
+    parallel_for(pieces, [&](int i)
+                 { std::stable_sort(bound(i), bound(i + 1), comp); });
+    for (int width = 1; width < pieces; width *= 2)
+    {
+        parallel_for(pieces / (2 * width), [&](int i)
+                     { std::inplace_merge(bound(2 * i * width), bound((2 * i + 1) * width), bound((2 * i + 2) * width), comp); });
+    }
+}
+
+// Lists shorter than this are sorted faster by comparison than by radix sort.
+inline constexpr std::size_t RADIX_THRESHOLD = 256;
+
+// Whether `T` is ordered lexicographically by the unsigned chars in [`data()`, `data() + size()`). Specialized for Str.
+template <typename T>
+inline constexpr bool is_byte_string = std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view>;
+
+// Whether the default order of `T` can be sorted by radix sort.
+template <typename T>
+concept radix_sortable = (std::is_integral_v<T> && !std::is_same_v<T, bool>) || std::is_same_v<T, float> || std::is_same_v<T, double> || is_byte_string<T>;
+
+// Map the number to an unsigned integer with the same order.
+template <typename T>
+static inline auto radix_key(T value)
+{
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        using U = std::conditional_t<sizeof(T) == 4, std::uint32_t, std::uint64_t>;
+        constexpr U SIGN = U(1) << (sizeof(U) * 8 - 1);
+        const U u = std::bit_cast<U>(value == 0 ? T(0) : value); // -0.0 is equal to 0.0
+        return (u & SIGN) ? U(~u) : U(u | SIGN);
+    }
+    else
+    {
+        using U = std::make_unsigned_t<T>;
+        constexpr U SIGN = std::is_signed_v<T> ? U(1) << (sizeof(U) * 8 - 1) : 0;
+        return U(U(value) ^ SIGN);
+    }
+}
+
+// Stable LSD radix sort of `items` by the unsigned keys which `key` returns, a byte per pass, or descending if `reverse`.
+template <typename Items, typename Key>
+static void lsd_radix_sort(Items& items, Key key, bool reverse)
+{
+    using K = decltype(key(items[0]));
+    constexpr int BYTES = sizeof(K);
+    const K flip = reverse ? K(~K(0)) : K(0);
+
+    // count all the digits in one pass
+    std::vector<std::array<std::size_t, 256>> counts(BYTES);
+    for (const auto& item : items)
+    {
+        const K k = key(item) ^ flip;
+        for (int b = 0; b < BYTES; ++b)
+        {
+            ++counts[b][(k >> (b * 8)) & 0xFF];
+        }
+    }
+
+    Items buffer(items.size(), items.get_allocator());
+    for (int b = 0; b < BYTES; ++b)
+    {
+        auto& count = counts[b];
+        if (std::find(count.begin(), count.end(), items.size()) != count.end()) // all the same digit
+        {
+            continue;
+        }
+
+        std::size_t offset = 0;
+        for (auto& c : count) // exclusive prefix sum
+        {
+            offset += std::exchange(c, offset);
+        }
+        for (auto& item : items)
+        {
+            buffer[count[((key(item) ^ flip) >> (b * 8)) & 0xFF]++] = std::move(item);
+        }
+        items.swap(buffer);
+    }
+}
+
+// A string to be sorted by radix sort, with its index in the original list.
+struct RadixItem
+{
+    const char* data;
+    std::size_t size;
+    int index;
+};
+
+// Get the digit of the string at `depth`, the end of the string is the smallest.
+static inline int radix_digit(const RadixItem& item, std::size_t depth)
+{
+    return depth < item.size ? static_cast<unsigned char>(item.data[depth]) + 1 : 0;
+}
+
+// Stable MSD radix sort of the strings in [`first`, `last`), whose first `depth` chars are all the same.
+static inline void msd_radix_sort(RadixItem* first, RadixItem* last, RadixItem* buffer, std::size_t depth)
+{
+    while (last - first > 1)
+    {
+        if (last - first < 32) // small range, compare the rest chars
+        {
+            std::stable_sort(first, last, [depth](const RadixItem& a, const RadixItem& b)
+                             { return std::string_view(a.data + depth, a.size - depth) < std::string_view(b.data + depth, b.size - depth); });
+            return;
+        }
+
+        std::array<std::size_t, 257> count{};
+        for (auto p = first; p != last; ++p)
+        {
+            ++count[radix_digit(*p, depth)];
+        }
+
+        std::array<std::size_t, 257> offset;
+        for (std::size_t d = 0, sum = 0; d < 257; ++d)
+        {
+            offset[d] = sum;
+            sum += count[d];
+        }
+        for (auto p = first; p != last; ++p)
+        {
+            buffer[offset[radix_digit(*p, depth)]++] = *p;
+        }
+        std::copy(buffer, buffer + (last - first), first);
+
+        // recurse into the smaller buckets and loop on the largest one, so the stack depth is O(log N)
+        int largest = 1;
+        for (int d = 1; d < 257; ++d)
+        {
+            largest = count[d] > count[largest] ? d : largest;
+        }
+        RadixItem* bucket = first + count[0]; // the strings that end at `depth` are all equal
+        RadixItem* next_first = nullptr;
+        for (int d = 1; d < 257; ++d)
+        {
+            if (d == largest)
+            {
+                next_first = bucket;
+            }
+            else if (count[d] > 1)
+            {
+                msd_radix_sort(bucket, bucket + count[d], buffer, depth + 1);
+            }
+            bucket += count[d];
+        }
+        last = next_first + count[largest];
+        first = next_first;
+        ++depth;
+    }
+}
+
+// Stable radix sort of `items` by the default order of `proj(item)`, or descending if `reverse`.
+template <typename Items, typename Proj>
+static void radix_sort(Items& items, Proj proj, bool reverse)
+{
+    using U = typename Items::value_type;
+    using K = std::decay_t<decltype(proj(items[0]))>;
+
+    if constexpr (is_byte_string<K>)
+    {
+        const int n = items.size();
+        std::vector<RadixItem> refs(n);
+        for (int i = 0; i < n; ++i)
+        {
+            const K& s = proj(items[i]);
+            refs[i] = {s.data(), std::size_t(s.size()), i};
+        }
+        std::vector<RadixItem> buffer(n);
+        msd_radix_sort(refs.data(), refs.data() + n, buffer.data(), 0);
+
+        if (reverse) // reverse the whole, and then reverse each run of equal strings back to keep it stable
+        {
+            std::reverse(refs.begin(), refs.end());
+            auto equal = [](const RadixItem& a, const RadixItem& b)
+            { return std::string_view(a.data, a.size) == std::string_view(b.data, b.size); };
+            for (auto run = refs.begin(); run != refs.end();)
+            {
+                auto next = std::adjacent_find(run, refs.end(), std::not_fn(equal));
+                next = next == refs.end() ? next : next + 1;
+                std::reverse(run, next);
+                run = next;
+            }
+        }
+
+        Items sorted(items.get_allocator());
+        sorted.reserve(n);
+        for (const auto& ref : refs)
+        {
+            sorted.push_back(std::move(items[ref.index]));
+        }
+        items = std::move(sorted);
+    }
+    else
+    {
+        lsd_radix_sort(items, [&](const U& item)
+                       { return radix_key(proj(item)); }, reverse);
+    }
+}
+
+// Start offset of a container which is rotated lazily over its storage as a ring: the element at index `i` is stored at `(start + i) % size`.
+// It is reset to 0 when moved from, like the storage which the move empties.
+struct RingOffset
+{
+    // Position of the first element in the storage.
+    std::size_t start = 0;
+
+    RingOffset() = default;
+
+    RingOffset(const RingOffset& that) = default;
+
+    RingOffset(RingOffset&& that) noexcept
+        : start(std::exchange(that.start, 0))
+    {
+    }
+
+    RingOffset& operator=(const RingOffset& that) = default;
+
+    RingOffset& operator=(RingOffset&& that) noexcept
+    {
+        start = std::exchange(that.start, 0);
+        return *this;
+    }
+
+    // Return the position in the storage of `size` elements of the element at `index` (0 <= `index` < `size`).
+    std::size_t position(std::size_t index, std::size_t size) const
+    {
+        index += start;
+        return index < size ? index : index - size;
+    }
+
+    // Rotate the `size` elements to left `n` (0 <= `n` < `size`) elements.
+    void rotate(std::size_t n, std::size_t size)
+    {
+        start = position(n, size);
+    }
+};
+
+// Start offset of a container which is not rotated lazily: the element at index `i` is stored at `i`, and the rotations move the elements.
+// It is empty, so the container keeps the size of its storage.
+struct ZeroOffset
+{
+    static constexpr std::size_t start = 0;
+
+    // Return the position in the storage of the element at `index`.
+    static std::size_t position(std::size_t index, std::size_t)
+    {
+        return index;
+    }
+};
+
+// Start offset of a container rotated lazily if `Ring` is true, see `RingOffset` and `ZeroOffset`.
+template <bool Ring>
+using OffsetOf = std::conditional_t<Ring, RingOffset, ZeroOffset>;
+
+// Random access iterator over the elements of a storage rotated lazily as a ring, see `RingOffset`.
+// It walks the storage from the start offset and wraps around at its end, so it reads the elements in order without moving them.
+// The iterators are compared by their indices, and the end iterator is the one at index `size`.
+template <typename Storage>
+class RingIterator
+{
+private:
+    using Iter = typename Storage::const_iterator;
+
+    // Bounds of the storage.
+    Iter first_;
+    Iter last_;
+
+    // Position in the storage of the element at `index_`.
+    Iter it_;
+
+    // Start offset of the rotations.
+    std::size_t start_ = 0;
+
+    // Index of the element in the rotated order.
+    std::ptrdiff_t index_ = 0;
+
+    // Move to the element at `index`.
+    void seek(std::ptrdiff_t index)
+    {
+        index_ = index;
+        const std::size_t pos = start_ + index_;
+        const std::size_t size = last_ - first_;
+        it_ = first_ + (pos < size ? pos : pos - size);
+    }
+
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = typename Storage::value_type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const value_type*;
+    using reference = std::iter_reference_t<Iter>; // bool for std::vector<bool>
+
+    RingIterator() = default;
+
+    RingIterator(const Storage& storage, std::size_t start, std::ptrdiff_t index)
+        : first_(storage.begin())
+        , last_(storage.end())
+        , start_(start)
+    {
+        seek(index);
+    }
+
+    reference operator*() const
+    {
+        return *it_;
+    }
+
+    pointer operator->() const
+        requires std::is_reference_v<reference>
+    {
+        return &*it_;
+    }
+
+    reference operator[](difference_type n) const
+    {
+        return *(*this + n);
+    }
+
+    RingIterator& operator++()
+    {
+        ++index_;
+        if (++it_ == last_)
+        {
+            it_ = first_;
+        }
+        return *this;
+    }
+
+    RingIterator operator++(int)
+    {
+        RingIterator it = *this;
+        ++*this;
+        return it;
+    }
+
+    RingIterator& operator--()
+    {
+        --index_;
+        if (it_ == first_)
+        {
+            it_ = last_;
+        }
+        --it_;
+        return *this;
+    }
+
+    RingIterator operator--(int)
+    {
+        RingIterator it = *this;
+        --*this;
+        return it;
+    }
+
+    RingIterator& operator+=(difference_type n)
+    {
+        seek(index_ + n);
+        return *this;
+    }
+
+    RingIterator& operator-=(difference_type n)
+    {
+        seek(index_ - n);
+        return *this;
+    }
+
+    friend RingIterator operator+(RingIterator it, difference_type n)
+    {
+        return it += n;
+    }
+
+    friend RingIterator operator+(difference_type n, RingIterator it)
+    {
+        return it += n;
+    }
+
+    friend RingIterator operator-(RingIterator it, difference_type n)
+    {
+        return it -= n;
+    }
+
+    friend difference_type operator-(const RingIterator& a, const RingIterator& b)
+    {
+        return a.index_ - b.index_;
+    }
+
+    bool operator==(const RingIterator& that) const
+    {
+        return index_ == that.index_;
+    }
+
+    auto operator<=>(const RingIterator& that) const
+    {
+        return index_ <=> that.index_;
+    }
+};
+
+// Allocator of the elements of a container, `void` stands for std::allocator.
+// The containers default to `void` rather than std::allocator, so that namespace std is not associated with them in argument-dependent lookup.
+template <typename T, typename Allocator>
+using allocator_of = std::conditional_t<std::is_void_v<Allocator>, std::allocator<T>, Allocator>;
+
+// Allocator which allocates from the memory resource if it has one, or by `operator new` like std::allocator otherwise.
+// It converts from std::pmr::polymorphic_allocator, so the containers with a polymorphic allocator pass their resource on to it,
+// and the default case is as cheap as std::allocator (the default polymorphic allocator goes through a virtual call and aligned new).
+template <typename T>
+class ResourceAllocator
+{
+private:
+    // Memory resource, or nullptr to use operator new.
+    std::pmr::memory_resource* resource_ = nullptr;
+
+public:
+    using value_type = T;
+
+    ResourceAllocator() = default;
+
+    ResourceAllocator(std::pmr::memory_resource* resource)
+        : resource_(resource)
+    {
+    }
+
+    template <typename U>
+    ResourceAllocator(const ResourceAllocator<U>& that)
+        : resource_(that.resource())
+    {
+    }
+
+    template <typename U>
+    ResourceAllocator(const std::pmr::polymorphic_allocator<U>& that)
+        : resource_(that.resource())
+    {
+    }
+
+    T* allocate(std::size_t n)
+    {
+        return resource_ ? static_cast<T*>(resource_->allocate(n * sizeof(T), alignof(T))) : std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T* p, std::size_t n)
+    {
+        resource_ ? resource_->deallocate(p, n * sizeof(T), alignof(T)) : std::allocator<T>().deallocate(p, n);
+    }
+
+    // A copy of a container allocates by operator new, like std::pmr::polymorphic_allocator uses the default resource.
+    ResourceAllocator select_on_container_copy_construction() const
+    {
+        return ResourceAllocator();
+    }
+
+    std::pmr::memory_resource* resource() const
+    {
+        return resource_;
+    }
+
+    template <typename U>
+    bool operator==(const ResourceAllocator<U>& that) const
+    {
+        return resource_ == that.resource();
+    }
+};
+
+// Vector which stores up to `N` elements inside the object, and moves them to the heap when it grows beyond that.
+// It has the subset of the interface of std::vector that the containers use, and iterators are plain pointers.
+template <typename T, std::size_t N>
+class SmallVector
+{
+    static_assert(N > 0, "SmallVector requires N > 0");
+
+private:
+    // Pointer to the elements, which is `inline_` or a heap buffer.
+    T* data_;
+
+    // Number of elements.
+    std::size_t size_ = 0;
+
+    // Number of elements that the buffer can hold.
+    std::size_t capacity_ = N;
+
+    // Inline buffer.
+    alignas(T) unsigned char inline_[N * sizeof(T)];
+
+    // Return the inline buffer.
+    T* inline_data()
+    {
+        return reinterpret_cast<T*>(inline_);
+    }
+
+    // Move or copy (if the move may throw and the copy is available) the elements of [`first`, `last`) to the uninitialized `buffer`.
+    static void relocate(T* first, T* last, T* buffer)
+    {
+        if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>)
+        {
+            std::uninitialized_move(first, last, buffer);
+        }
+        else
+        {
+            std::uninitialized_copy(first, last, buffer);
+        }
+        std::destroy(first, last);
+    }
+
+    // Move the elements to a heap buffer of `capacity`, after `construct(buffer)` constructs `count` new elements at `buffer + size_`.
+    // The new elements are constructed first, so they can be copied from the old elements.
+    template <typename F>
+    void reallocate(std::size_t capacity, std::size_t count, const F& construct)
+    {
+        T* buffer = std::allocator<T>().allocate(capacity);
+        try
+        {
+            construct(buffer);
+        }
+        catch (...)
+        {
+            std::allocator<T>().deallocate(buffer, capacity);
+            throw;
+        }
+
+        try
+        {
+            relocate(data_, data_ + size_, buffer);
+        }
+        catch (...)
+        {
+            std::destroy(buffer + size_, buffer + size_ + count);
+            std::allocator<T>().deallocate(buffer, capacity);
+            throw;
+        }
+
+        release();
+        data_ = buffer;
+        capacity_ = capacity;
+    }
+
+    // Deallocate the heap buffer if any, the elements must be destroyed already.
+    void release()
+    {
+        if (data_ != inline_data())
+        {
+            std::allocator<T>().deallocate(data_, capacity_);
+        }
+    }
+
+    // Return the capacity after growing to hold at least `size` elements.
+    std::size_t grown(std::size_t size) const
+    {
+        return std::max(size, capacity_ * 2);
+    }
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using iterator = T*;
+    using const_iterator = const T*;
+    using reverse_iterator = std::reverse_iterator<T*>;
+    using const_reverse_iterator = std::reverse_iterator<const T*>;
+
+    // The heap buffer is always allocated by std::allocator, the constructors taking an allocator are for the generic code.
+    using allocator_type = std::allocator<T>;
+
+    SmallVector()
+        : data_(inline_data())
+    {
+    }
+
+    explicit SmallVector(const allocator_type&)
+        : SmallVector()
+    {
+    }
+
+    explicit SmallVector(std::size_t count, const allocator_type& = allocator_type())
+        : SmallVector()
+    {
+        reserve(count);
+        std::uninitialized_value_construct_n(data_, count);
+        size_ = count;
+    }
+
+    template <std::input_iterator InputIt>
+    SmallVector(const InputIt& first, const InputIt& last, const allocator_type& = allocator_type())
+        : SmallVector()
+    {
+        insert(end(), first, last);
+    }
+
+    SmallVector(const std::initializer_list<T>& init, const allocator_type& = allocator_type())
+        : SmallVector(init.begin(), init.end())
+    {
+    }
+
+    SmallVector(const SmallVector& that, const allocator_type& = allocator_type())
+        : SmallVector(that.begin(), that.end())
+    {
+    }
+
+    SmallVector(SmallVector&& that) noexcept(std::is_nothrow_move_constructible_v<T>)
+        : SmallVector()
+    {
+        *this = std::move(that);
+    }
+
+    SmallVector(SmallVector&& that, const allocator_type&)
+        : SmallVector(std::move(that))
+    {
+    }
+
+    ~SmallVector()
+    {
+        clear();
+        release();
+    }
+
+    SmallVector& operator=(const SmallVector& that)
+    {
+        if (this != &that)
+        {
+            clear();
+            insert(end(), that.begin(), that.end());
+        }
+        return *this;
+    }
+
+    // Take over the heap buffer of `that`, or move its inline elements.
+    SmallVector& operator=(SmallVector&& that) noexcept(std::is_nothrow_move_constructible_v<T>)
+    {
+        if (this == &that)
+        {
+            return *this;
+        }
+
+        clear();
+        if (that.data_ != that.inline_data())
+        {
+            release();
+            data_ = std::exchange(that.data_, that.inline_data());
+            size_ = std::exchange(that.size_, 0);
+            capacity_ = std::exchange(that.capacity_, N);
+        }
+        else // fits in the buffer of this, whose capacity is at least N
+        {
+            std::uninitialized_move(that.begin(), that.end(), data_);
+            size_ = that.size_;
+            that.clear();
+        }
+        return *this;
+    }
+
+    bool operator==(const SmallVector& that) const
+    {
+        return std::equal(begin(), end(), that.begin(), that.end());
+    }
+
+    // Compare lexicographically, like std::vector.
+    auto operator<=>(const SmallVector& that) const
+    {
+        return std::lexicographical_compare_three_way(begin(), end(), that.begin(), that.end(), synth_three_way<T>);
+    }
+
+    T* begin()
+    {
+        return data_;
+    }
+
+    const T* begin() const
+    {
+        return data_;
+    }
+
+    T* end()
+    {
+        return data_ + size_;
+    }
+
+    const T* end() const
+    {
+        return data_ + size_;
+    }
+
+    reverse_iterator rbegin()
+    {
+        return reverse_iterator(end());
+    }
+
+    const_reverse_iterator rbegin() const
+    {
+        return const_reverse_iterator(end());
+    }
+
+    reverse_iterator rend()
+    {
+        return reverse_iterator(begin());
+    }
+
+    const_reverse_iterator rend() const
+    {
+        return const_reverse_iterator(begin());
+    }
+
+    T& operator[](std::size_t index)
+    {
+        return data_[index];
+    }
+
+    const T& operator[](std::size_t index) const
+    {
+        return data_[index];
+    }
+
+    T* data()
+    {
+        return data_;
+    }
+
+    const T* data() const
+    {
+        return data_;
+    }
+
+    std::size_t size() const
+    {
+        return size_;
+    }
+
+    bool empty() const
+    {
+        return size_ == 0;
+    }
+
+    std::size_t capacity() const
+    {
+        return capacity_;
+    }
+
+    allocator_type get_allocator() const
+    {
+        return allocator_type();
+    }
+
+    // Return `true` if the elements are stored inside the object.
+    bool is_inline() const
+    {
+        return data_ == reinterpret_cast<const T*>(inline_);
+    }
+
+    void reserve(std::size_t capacity)
+    {
+        if (capacity > capacity_)
+        {
+            reallocate(capacity, 0, [](T*) {});
+        }
+    }
+
+    void clear()
+    {
+        std::destroy(begin(), end());
+        size_ = 0;
+    }
+
+    template <typename... Args>
+    T& emplace_back(Args&&... args)
+    {
+        if (size_ == capacity_)
+        {
+            reallocate(grown(size_ + 1), 1, [&](T* buffer)
+                       { std::construct_at(buffer + size_, std::forward<Args>(args)...); });
+        }
+        else
+        {
+            std::construct_at(data_ + size_, std::forward<Args>(args)...);
+        }
+        return data_[size_++];
+    }
+
+    void push_back(const T& element)
+    {
+        emplace_back(element);
+    }
+
+    void push_back(T&& element)
+    {
+        emplace_back(std::move(element));
+    }
+
+    template <typename... Args>
+    T* emplace(const T* pos, Args&&... args)
+    {
+        const std::size_t index = pos - data_;
+        emplace_back(std::forward<Args>(args)...);
+        std::rotate(data_ + index, data_ + size_ - 1, data_ + size_);
+        return data_ + index;
+    }
+
+    T* insert(const T* pos, const T& element)
+    {
+        return emplace(pos, element);
+    }
+
+    T* insert(const T* pos, T&& element)
+    {
+        return emplace(pos, std::move(element));
+    }
+
+    // Insert the elements of [`first`, `last`) before `pos`, they are appended first and then rotated into place,
+    // so the range can be a part of this vector.
+    template <std::input_iterator InputIt>
+    T* insert(const T* pos, InputIt first, const InputIt& last)
+    {
+        const std::size_t index = pos - data_;
+        const std::size_t old_size = size_;
+        if constexpr (std::forward_iterator<InputIt>)
+        {
+            const std::size_t count = std::distance(first, last);
+            if (size_ + count > capacity_)
+            {
+                reallocate(grown(size_ + count), count, [&](T* buffer)
+                           { std::uninitialized_copy(first, last, buffer + size_); });
+            }
+            else
+            {
+                std::uninitialized_copy(first, last, data_ + size_);
+            }
+            size_ += count;
+        }
+        else
+        {
+            for (; first != last; ++first)
+            {
+                emplace_back(*first);
+            }
+        }
+        std::rotate(data_ + index, data_ + old_size, data_ + size_);
+        return data_ + index;
+    }
+
+    T* erase(const T* pos)
+    {
+        return erase(pos, pos + 1);
+    }
+
+    T* erase(const T* first, const T* last)
+    {
+        T* it = data_ + (first - data_);
+        T* new_end = std::move(data_ + (last - data_), end(), it);
+        std::destroy(new_end, end());
+        size_ = new_end - data_;
+        return it;
+    }
+
+    void swap(SmallVector& that)
+    {
+        SmallVector temp(std::move(that));
+        that = std::move(*this);
+        *this = std::move(temp);
+    }
+};
+
 // Get the GCD of numbers for generics.
 template <typename T>
 static inline T gcd(T a, T b)
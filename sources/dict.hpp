@@ -18,37 +18,61 @@ template <typename K, typename V>
 using Pair = std::pair<const K, V>;
 
 /// Dict maps keys to arbitrary values.
-template <typename K, typename V>
+/// The memory is allocated by `Allocator` (std::allocator if void), see `pmr::Dict` for dictionaries in an `Arena`.
+template <typename K, typename V, typename Allocator = void>
 class Dict
 {
 private:
     // Map of key-value pairs.
-    std::map<K, V> map_;
+    // The comparator is transparent for heterogeneous lookup, see `detail::transparent_key`.
+    std::map<K, V, std::less<>, detail::allocator_of<Pair<K, V>, Allocator>> map_;
 
 public:
     /*
      * Constructor
      */
 
+    /// Type of the allocator.
+    /// The containers with a polymorphic allocator pass their memory resource on to the `pmr::Dict` elements.
+    using allocator_type = detail::allocator_of<Pair<K, V>, Allocator>;
+
     /// Create an empty dictionary.
     Dict() = default;
 
+    /// Create an empty dictionary which allocates by the `allocator`, like `pmr::Dict<Str, int>(&arena)`.
+    explicit Dict(const allocator_type& allocator)
+        : map_(allocator)
+    {
+    }
+
     /// Create a dictionary with the contents of the initializer list `init`.
-    Dict(const std::initializer_list<Pair<K, V>>& init)
-        : map_(init)
+    Dict(const std::initializer_list<Pair<K, V>>& init, const allocator_type& allocator = allocator_type())
+        : map_(init, allocator)
     {
     }
 
     /// Create a dictionary with the contents of the range [`first`, `last`).
     template <std::input_iterator InputIt>
-    Dict(const InputIt& first, const InputIt& last)
-        : map_(first, last)
+    Dict(const InputIt& first, const InputIt& last, const allocator_type& allocator = allocator_type())
+        : map_(first, last, allocator)
     {
     }
 
     /// Create a dictionary from std::map.
-    Dict(const std::map<K, V>& map)
-        : map_(map)
+    Dict(const std::map<K, V>& map, const allocator_type& allocator = allocator_type())
+        : map_(map.begin(), map.end(), allocator)
+    {
+    }
+
+    /// Create a copy of the dictionary which allocates by the `allocator`.
+    Dict(const Dict& that, const allocator_type& allocator)
+        : map_(that.map_, allocator)
+    {
+    }
+
+    /// Move the dictionary into one which allocates by the `allocator`, the elements are moved one by one if the allocators differ.
+    Dict(Dict&& that, const allocator_type& allocator)
+        : map_(std::move(that.map_), allocator)
     {
     }
 
@@ -109,10 +133,41 @@ public:
         return const_cast<Dict&>(*this)[key];
     }
 
+    /// Return the reference to the value of the `key` in the dictionary, without constructing a K from the `key`.
+    /// Such as looking up a `Dict<Str, V>` by `const char*` or `std::string_view`.
+    template <detail::transparent_key<K> Key>
+    V& operator[](const Key& key)
+    {
+        auto it = map_.find(key);
+        if (it == map_.end())
+        {
+            throw std::runtime_error("Error: Key is not found in the dictionary.");
+        }
+
+        return it->second;
+    }
+
+    /// Return the const reference to value of the `key` in the dictionary, without constructing a K from the `key`.
+    template <detail::transparent_key<K> Key>
+    const V& operator[](const Key& key) const
+    {
+        return const_cast<Dict&>(*this)[key];
+    }
+
     /// Return a reference of the value for `key` if `key` is in the dictionary, else `defaults` value.
     const V& get(const K& key, const V& defaults) const
     {
-        return contains(key) ? (*this)[key] : defaults;
+        auto it = map_.find(key);
+        return it != map_.end() ? it->second : defaults;
+    }
+
+    /// Return a reference of the value for `key` if `key` is in the dictionary, else `defaults` value,
+    /// without constructing a K from the `key`.
+    template <detail::transparent_key<K> Key>
+    const V& get(const Key& key, const V& defaults) const
+    {
+        auto it = map_.find(key);
+        return it != map_.end() ? it->second : defaults;
     }
 
     /*
@@ -131,6 +186,12 @@ public:
         return map_.empty();
     }
 
+    /// Return the allocator of the dictionary.
+    allocator_type get_allocator() const
+    {
+        return map_.get_allocator();
+    }
+
     /// Return the iterator of the specified key or end() if the dictionary does not contain the key.
     auto find(const K& key) const
     {
@@ -143,6 +204,21 @@ public:
         return map_.find(key) != map_.end();
     }
 
+    /// Return the iterator of the specified key or end() if the dictionary does not contain the key,
+    /// without constructing a K from the `key`.
+    template <detail::transparent_key<K> Key>
+    auto find(const Key& key) const
+    {
+        return map_.find(key);
+    }
+
+    /// Return `true` if the dictionary contains the specified `key`, without constructing a K from the `key`.
+    template <detail::transparent_key<K> Key>
+    bool contains(const Key& key) const
+    {
+        return map_.find(key) != map_.end();
+    }
+
     /// Get the smallest key of the dictionary.
     K min() const
     {
@@ -194,7 +270,7 @@ public:
     {
         detail::check_full(size(), INT_MAX);
 
-        return map_.insert({key, value}).second;
+        return map_.try_emplace(key, value).second;
     }
 
     /// Remove `key` from the dictionary. Return `true` if such an `key` was present.
@@ -236,6 +312,15 @@ public:
     }
 };
 
+namespace pmr
+{
+
+/// Dict which allocates from a memory resource, like an `Arena`, and passes it on to the keys and values which are allocator-aware.
+template <typename K, typename V>
+using Dict = pyincpp::Dict<K, V, std::pmr::polymorphic_allocator<Pair<K, V>>>;
+
+} // namespace pmr
+
 } // namespace pyincpp
 
 #endif // DICT_HPP
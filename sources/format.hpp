@@ -0,0 +1,393 @@
+//! @file format.hpp
+//! @author Chen QingYu <chen_qingyu@qq.com>
+//! @brief Compile-time checked string formatting.
+//! @date 2026.10.16
+
+#ifndef FORMAT_HPP
+#define FORMAT_HPP
+
+#include "str_builder.hpp"
+
+#if __has_include(<format>)
+#include <format> // std::formatter
+#endif
+
+namespace pyincpp
+{
+
+namespace detail
+{
+
+// Format specification of a replacement field: `{:[[fill]align][width][.precision][type]}`.
+struct FormatSpec
+{
+    char fill = ' ';
+    char align = '\0'; // '<', '>', '^', or '\0' for the default of the argument type
+    int width = 0;
+    int precision = -1; // -1 means not specified
+    char type = '\0';   // 'f', 'e', 'g', or '\0' for the default
+};
+
+// Literal text of a format string and the replacement field that follows it.
+struct FormatField
+{
+    int start = 0;        // start of the literal text
+    int len = 0;          // length of the literal text
+    bool escaped = false; // whether the literal text contains "{{" or "}}"
+    FormatSpec spec;
+};
+
+// Whether the precision is meaningful for the argument type.
+template <typename T>
+constexpr bool format_has_precision = std::floating_point<T> || std::is_same_v<T, Complex> || std::is_same_v<T, Str> || std::is_convertible_v<const T&, std::string_view>;
+
+// Whether the presentation type 'f', 'e' and 'g' is meaningful for the argument type.
+template <typename T>
+constexpr bool format_has_type = std::floating_point<T> || std::is_same_v<T, Complex>;
+
+// Numbers are aligned to the right by default, others are aligned to the left.
+template <typename T>
+constexpr char format_default_align = ((std::is_arithmetic_v<T> && !std::is_same_v<T, char>) || std::is_same_v<T, Int> || std::is_same_v<T, Fraction> || std::is_same_v<T, Complex>) ? '>' : '<';
+
+} // namespace detail
+
+/// Format string which is checked and parsed at compile time against the types of `Args`.
+///
+/// Replacement fields are `{}` or `{:[[fill]align][width][.precision][type]}`, like Python's `str.format()`:
+/// - `align` is '<' (left), '>' (right) or '^' (center), `fill` is any char except '{' and '}'.
+/// - `.precision` is the number of digits for floating-point numbers, or the maximum length for strings.
+/// - `type` is 'f' (fixed), 'e' (scientific) or 'g' (general) for floating-point numbers.
+///
+/// Use "{{" and "}}" for literal braces. Any error in the format string is a compile error.
+template <typename... Args>
+class FormatStr
+{
+private:
+    // Format string.
+    std::string_view str_;
+
+    // Fields parsed from the format string, the last one only holds the trailing literal text.
+    detail::FormatField fields_[sizeof...(Args) + 1];
+
+    // Number of replacement fields.
+    int count_ = 0;
+
+    // Parse the spec starting at `i` (after ':'), return the index of the closing '}'.
+    consteval int parse_spec(int i, detail::FormatSpec& spec, bool has_precision, bool has_type) const
+    {
+        const int n = str_.size();
+        auto is_align = [](char c)
+        { return c == '<' || c == '>' || c == '^'; };
+
+        if (i + 1 < n && is_align(str_[i + 1]) && str_[i] != '{' && str_[i] != '}')
+        {
+            spec.fill = str_[i];
+            spec.align = str_[i + 1];
+            i += 2;
+        }
+        else if (i < n && is_align(str_[i]))
+        {
+            spec.align = str_[i++];
+        }
+
+        for (; i < n && str_[i] >= '0' && str_[i] <= '9'; ++i)
+        {
+            spec.width = spec.width * 10 + (str_[i] - '0');
+        }
+
+        if (i < n && str_[i] == '.')
+        {
+            if (++i == n || str_[i] < '0' || str_[i] > '9' || !has_precision)
+            {
+                throw std::runtime_error("Error: Invalid precision in format string.");
+            }
+
+            for (spec.precision = 0; i < n && str_[i] >= '0' && str_[i] <= '9'; ++i)
+            {
+                spec.precision = spec.precision * 10 + (str_[i] - '0');
+            }
+        }
+
+        if (i < n && (str_[i] == 'f' || str_[i] == 'e' || str_[i] == 'g'))
+        {
+            if (!has_type)
+            {
+                throw std::runtime_error("Error: Invalid type in format string.");
+            }
+
+            spec.type = str_[i++];
+        }
+
+        if (i == n || str_[i] != '}')
+        {
+            throw std::runtime_error("Error: Invalid format string.");
+        }
+
+        return i;
+    }
+
+    // Parse the format string.
+    consteval void parse()
+    {
+        constexpr bool has_precision[] = {detail::format_has_precision<Args>..., false};
+        constexpr bool has_type[] = {detail::format_has_type<Args>..., false};
+
+        const int n = str_.size();
+        int i = 0;
+        while (true)
+        {
+            auto& field = fields_[count_];
+            field.start = i;
+
+            // literal text
+            while (i < n && str_[i] != '{' && str_[i] != '}')
+            {
+                ++i;
+            }
+            while (i + 1 < n && str_[i] == str_[i + 1]) // "{{" or "}}"
+            {
+                field.escaped = true;
+                for (i += 2; i < n && str_[i] != '{' && str_[i] != '}'; ++i)
+                {
+                }
+            }
+            field.len = i - field.start;
+
+            if (i == n)
+            {
+                return;
+            }
+
+            // replacement field
+            if (str_[i] == '}' || count_ == sizeof...(Args))
+            {
+                throw std::runtime_error(str_[i] == '}' ? "Error: Unmatched '}' in format string." : "Error: Too many replacement fields in format string.");
+            }
+            if (++i < n && str_[i] == ':')
+            {
+                i = parse_spec(i + 1, field.spec, has_precision[count_], has_type[count_]);
+            }
+            else if (i == n || str_[i] != '}')
+            {
+                throw std::runtime_error("Error: Invalid format string.");
+            }
+            ++i; // skip '}'
+            ++count_;
+        }
+    }
+
+    // Append the literal text of the `field`.
+    void write_literal(StrBuilder& sb, const detail::FormatField& field) const
+    {
+        if (!field.escaped)
+        {
+            sb.append(str_.data() + field.start, field.len);
+            return;
+        }
+
+        for (int i = field.start; i < field.start + field.len; ++i)
+        {
+            sb.append(str_[i]);
+            i += (str_[i] == '{' || str_[i] == '}'); // skip the escaped one
+        }
+    }
+
+    // Append the `value` formatted according to the `spec`.
+    template <typename T>
+    static void write_value(StrBuilder& sb, const T& value, const detail::FormatSpec& spec)
+    {
+        const int start = sb.size();
+
+        if constexpr (std::floating_point<T>)
+        {
+            if (spec.precision != -1 || spec.type != '\0')
+            {
+                sb.append(double(value), spec.type == 'f' ? std::chars_format::fixed : (spec.type == 'e' ? std::chars_format::scientific : std::chars_format::general), spec.precision == -1 ? 6 : spec.precision);
+            }
+            else
+            {
+                sb.append(double(value));
+            }
+        }
+        else if constexpr (std::is_same_v<T, Complex>)
+        {
+            detail::FormatSpec part_spec = spec;
+            part_spec.width = 0;
+            sb.append('(');
+            write_value(sb, value.real(), part_spec);
+            sb.append(value.imag() < 0 ? '-' : '+');
+            write_value(sb, std::abs(value.imag()), part_spec);
+            sb.append("j)");
+        }
+        else if constexpr (detail::format_has_precision<T>)
+        {
+            std::string_view str = [&]()
+            {
+                if constexpr (std::is_same_v<T, Str>)
+                {
+                    return std::string_view(value.data(), value.size());
+                }
+                else
+                {
+                    return std::string_view(value);
+                }
+            }();
+            if (spec.precision != -1 && spec.precision < int(str.size()))
+            {
+                str = str.substr(0, spec.precision);
+            }
+            sb.append(str.data(), str.size());
+        }
+        else if constexpr (requires { sb.append(value); })
+        {
+            sb.append(value);
+        }
+        else // fallback for types that are only printable
+        {
+            std::ostringstream oss;
+            oss << value;
+            sb.append(oss.str().data(), oss.str().size());
+        }
+
+        if (spec.width > 0)
+        {
+            sb.pad(start, spec.width, spec.fill, spec.align == '\0' ? detail::format_default_align<T> : spec.align);
+        }
+    }
+
+public:
+    /// Create a format string, it is checked and parsed at compile time.
+    template <typename S>
+        requires std::is_convertible_v<const S&, std::string_view>
+    consteval FormatStr(const S& str)
+        : str_(str)
+    {
+        parse();
+    }
+
+    /// Return the format string.
+    constexpr std::string_view get() const
+    {
+        return str_;
+    }
+
+    /// Format `args` according to the format string, and return the result as a string.
+    Str format(const Args&... args) const
+    {
+        // estimate the size of the result so that the buffer rarely grows
+        int len = fields_[count_].len;
+        for (int i = 0; i < count_; ++i)
+        {
+            len += fields_[i].len + std::max(fields_[i].spec.width, 16);
+        }
+
+        StrBuilder sb(len);
+        int i = 0;
+        [[maybe_unused]] auto write_field = [&](const auto& value) // unused if there are no arguments
+        {
+            if (i < count_) // the arguments without a field are ignored, like Python
+            {
+                write_literal(sb, fields_[i]);
+                write_value(sb, value, fields_[i].spec);
+                ++i;
+            }
+        };
+        (write_field(args), ...);
+        write_literal(sb, fields_[count_]);
+
+        return sb.build();
+    }
+};
+
+/// Format `args` according to the format string `fmt` which is checked and parsed at compile time,
+/// and return the result as a string.
+///
+/// ### Example
+/// ```
+/// format("I'm {}, {} years old.", "Alice", 18); // "I'm Alice, 18 years old."
+/// format("{:*^7}|{:>6.2f}|{:.3}", Int(42), 3.14159, Str("abcdef")); // "**42***|  3.14|abc"
+/// format("{:d}", 1); // compile error
+/// ```
+template <typename... Args>
+Str format(const FormatStr<std::type_identity_t<Args>...>& fmt, const Args&... args)
+{
+    return fmt.format(args...);
+}
+
+} // namespace pyincpp
+
+#ifdef __cpp_lib_format
+
+namespace pyincpp::detail
+{
+
+// Base of the std::formatter specializations.
+// Write the value with StrBuilder, and then let std::formatter<std::string_view> handle the fill, align, width and precision.
+template <typename T>
+struct StdFormatter : std::formatter<std::string_view>
+{
+    template <typename FormatContext>
+    auto format(const T& value, FormatContext& ctx) const
+    {
+        StrBuilder sb;
+        sb.append(value);
+        Str str = sb.build();
+        return std::formatter<std::string_view>::format(std::string_view(str.data(), str.size()), ctx);
+    }
+};
+
+} // namespace pyincpp::detail
+
+template <>
+struct std::formatter<pyincpp::Int> : pyincpp::detail::StdFormatter<pyincpp::Int>
+{
+};
+
+template <>
+struct std::formatter<pyincpp::Fraction> : pyincpp::detail::StdFormatter<pyincpp::Fraction>
+{
+};
+
+template <>
+struct std::formatter<pyincpp::Complex> : pyincpp::detail::StdFormatter<pyincpp::Complex>
+{
+};
+
+template <>
+struct std::formatter<pyincpp::Str> : pyincpp::detail::StdFormatter<pyincpp::Str>
+{
+};
+
+template <typename T, std::size_t N, typename A, bool R>
+struct std::formatter<pyincpp::List<T, N, A, R>> : pyincpp::detail::StdFormatter<pyincpp::List<T, N, A, R>>
+{
+};
+
+template <typename T>
+struct std::formatter<pyincpp::GapList<T>> : pyincpp::detail::StdFormatter<pyincpp::GapList<T>>
+{
+};
+
+template <typename T, typename A>
+struct std::formatter<pyincpp::Set<T, A>> : pyincpp::detail::StdFormatter<pyincpp::Set<T, A>>
+{
+};
+
+template <typename K, typename V, typename A>
+struct std::formatter<pyincpp::Dict<K, V, A>> : pyincpp::detail::StdFormatter<pyincpp::Dict<K, V, A>>
+{
+};
+
+template <typename T, typename A, bool R>
+struct std::formatter<pyincpp::Deque<T, A, R>> : pyincpp::detail::StdFormatter<pyincpp::Deque<T, A, R>>
+{
+};
+
+template <typename... Ts>
+struct std::formatter<pyincpp::Tuple<Ts...>> : pyincpp::detail::StdFormatter<pyincpp::Tuple<Ts...>>
+{
+};
+
+#endif // __cpp_lib_format
+
+#endif // FORMAT_HPP
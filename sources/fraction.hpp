@@ -319,7 +319,7 @@ struct std::hash<pyincpp::Fraction> // explicit specialization
 {
     std::size_t operator()(const pyincpp::Fraction& fraction) const
     {
-        return std::hash<int>{}(fraction.numerator()) ^ (std::hash<int>{}(fraction.denominator()) << 1);
+        return pyincpp::detail::hash_word((std::uint64_t(std::uint32_t(fraction.numerator())) << 32) | std::uint32_t(fraction.denominator()));
     }
 };
 
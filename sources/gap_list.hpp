@@ -0,0 +1,478 @@
+//! @file gap_list.hpp
+//! @author Chen QingYu <chen_qingyu@qq.com>
+//! @brief GapList template class.
+//! @date 2026.10.16
+
+#ifndef GAP_LIST_HPP
+#define GAP_LIST_HPP
+
+#include "detail.hpp"
+
+namespace pyincpp
+{
+
+/// GapList is collection of homogeneous objects for editing workloads, stored as a gap buffer.
+/// The gap follows the last edit, so insertion and removal at or near it are amortized O(1),
+/// and an edit at distance D from the previous one moves D elements (List always moves all the elements after the edit).
+/// Indexing stays O(1), and the interface follows List: negative indexing, `slice()`, rotation and printing.
+///
+/// ### Example
+/// ```
+/// GapList<char> text = {'h', 'e', 'l', 'o'};
+/// text.insert(3, 'l'); // the gap moves to 3
+/// text.insert(4, ','); // amortized O(1), right after the gap
+/// text.remove(-1); // 'o'
+/// text; // [h, e, l, l, ,]
+/// ```
+template <typename T>
+class GapList
+{
+private:
+    // Elements before the gap, in order.
+    std::vector<T> front_;
+
+    // Elements after the gap, in reverse order, so that both sides grow and shrink at the gap.
+    std::vector<T> back_;
+
+    // Move the gap to the position `pos`, moving the elements between.
+    void move_gap(int pos)
+    {
+        const int gap = front_.size();
+        if (pos < gap)
+        {
+            auto first = front_.begin() + pos;
+            back_.insert(back_.end(), std::make_move_iterator(front_.rbegin()), std::make_move_iterator(std::make_reverse_iterator(first)));
+            front_.erase(first, front_.end());
+        }
+        else if (pos > gap)
+        {
+            auto first = back_.end() - (pos - gap);
+            front_.insert(front_.end(), std::make_move_iterator(back_.rbegin()), std::make_move_iterator(std::make_reverse_iterator(first)));
+            back_.erase(first, back_.end());
+        }
+    }
+
+    // Return the reference to the element at the position `pos` in [0, size()).
+    const T& at(int pos) const
+    {
+        const int gap = front_.size();
+        return pos < gap ? front_[pos] : back_[back_.size() - 1 - (pos - gap)];
+    }
+
+    // Random access iterator, which maps the position across the gap.
+    class Iterator
+    {
+    private:
+        const GapList* list_ = nullptr;
+        int pos_ = 0;
+
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        Iterator() = default;
+
+        Iterator(const GapList* list, int pos)
+            : list_(list)
+            , pos_(pos)
+        {
+        }
+
+        const T& operator*() const
+        {
+            return list_->at(pos_);
+        }
+
+        const T* operator->() const
+        {
+            return &list_->at(pos_);
+        }
+
+        const T& operator[](difference_type n) const
+        {
+            return list_->at(pos_ + n);
+        }
+
+        Iterator& operator++()
+        {
+            ++pos_;
+            return *this;
+        }
+
+        Iterator operator++(int)
+        {
+            return Iterator(list_, pos_++);
+        }
+
+        Iterator& operator--()
+        {
+            --pos_;
+            return *this;
+        }
+
+        Iterator operator--(int)
+        {
+            return Iterator(list_, pos_--);
+        }
+
+        Iterator& operator+=(difference_type n)
+        {
+            pos_ += n;
+            return *this;
+        }
+
+        Iterator& operator-=(difference_type n)
+        {
+            pos_ -= n;
+            return *this;
+        }
+
+        friend Iterator operator+(Iterator it, difference_type n)
+        {
+            return it += n;
+        }
+
+        friend Iterator operator+(difference_type n, Iterator it)
+        {
+            return it += n;
+        }
+
+        friend Iterator operator-(Iterator it, difference_type n)
+        {
+            return it -= n;
+        }
+
+        friend difference_type operator-(const Iterator& a, const Iterator& b)
+        {
+            return a.pos_ - b.pos_;
+        }
+
+        bool operator==(const Iterator& that) const
+        {
+            return pos_ == that.pos_;
+        }
+
+        auto operator<=>(const Iterator& that) const
+        {
+            return pos_ <=> that.pos_;
+        }
+    };
+
+public:
+    /*
+     * Constructor
+     */
+
+    /// Create an empty list.
+    GapList() = default;
+
+    /// Create a list with the contents of the initializer list `init`.
+    GapList(const std::initializer_list<T>& init)
+        : front_(init)
+    {
+    }
+
+    /// Create a list with the contents of the range [`first`, `last`).
+    template <std::input_iterator InputIt>
+    GapList(const InputIt& first, const InputIt& last)
+        : front_(first, last)
+    {
+    }
+
+    /*
+     * Comparison
+     */
+
+    /// Check whether two lists are equal.
+    bool operator==(const GapList& that) const
+    {
+        return std::equal(begin(), end(), that.begin(), that.end());
+    }
+
+    /// Compare the list with another list lexicographically.
+    auto operator<=>(const GapList& that) const
+    {
+        return std::lexicographical_compare_three_way(begin(), end(), that.begin(), that.end(), detail::synth_three_way<T>);
+    }
+
+    /*
+     * Iterator
+     */
+
+    /// Return an iterator to the first element of the list.
+    Iterator begin() const
+    {
+        return Iterator(this, 0);
+    }
+
+    /// Return an iterator to the element following the last element of the list.
+    Iterator end() const
+    {
+        return Iterator(this, size());
+    }
+
+    /// Return a reverse iterator to the first element of the reversed list.
+    auto rbegin() const
+    {
+        return std::make_reverse_iterator(end());
+    }
+
+    /// Return a reverse iterator to the element following the last element of the reversed list.
+    auto rend() const
+    {
+        return std::make_reverse_iterator(begin());
+    }
+
+    /*
+     * Access
+     */
+
+    /// Return the reference to the element at the specified position in the list.
+    /// Index can be negative, like Python's list: list[-1] gets the last element.
+    T& operator[](int index)
+    {
+        return const_cast<T&>(std::as_const(*this)[index]);
+    }
+
+    /// Return the const reference to element at the specified position in the list.
+    /// Index can be negative, like Python's list: list[-1] gets the last element.
+    const T& operator[](int index) const
+    {
+        detail::check_bounds(index, -size(), size());
+
+        return at(index >= 0 ? index : index + size());
+    }
+
+    /*
+     * Examination
+     */
+
+    /// Return the number of elements in the list.
+    int size() const
+    {
+        return front_.size() + back_.size();
+    }
+
+    /// Return `true` if the list contains no elements.
+    bool is_empty() const
+    {
+        return front_.empty() && back_.empty();
+    }
+
+    /// Return the index of the first occurrence of the specified `element`, or -1 if the list does not contain the element in the specified range [`start`, `stop`].
+    int index(const T& element, int start = 0, int stop = INT_MAX) const
+    {
+        stop = stop > size() ? size() : stop;
+        auto it = std::find(begin() + start, begin() + stop, element);
+        return it == begin() + stop ? -1 : it - begin();
+    }
+
+    /// Return `true` if the list contains the specified `element` in the specified range [`start`, `stop`].
+    bool contains(const T& element, int start = 0, int stop = INT_MAX) const
+    {
+        return index(element, start, stop) != -1;
+    }
+
+    /// Count the total number of occurrences of the specified `element` in the list.
+    int count(const T& element) const
+    {
+        return std::count(front_.begin(), front_.end(), element) + std::count(back_.begin(), back_.end(), element);
+    }
+
+    /*
+     * Manipulation
+     */
+
+    /// Insert the specified `element` at the specified `index` in the list, and move the gap after it.
+    /// Index can be negative.
+    void insert(int index, const T& element)
+    {
+        emplace(index, element);
+    }
+
+    /// Insert the specified `element` at the specified `index` in the list, moving it.
+    /// Index can be negative.
+    void insert(int index, T&& element)
+    {
+        emplace(index, std::move(element));
+    }
+
+    /// Insert an element constructed in place from `args` at the specified `index` in the list, and return a reference to it.
+    /// Index can be negative.
+    template <typename... Args>
+    decltype(auto) emplace(int index, Args&&... args)
+    {
+        detail::check_full(size(), INT_MAX);
+        detail::check_bounds(index, -size(), size() + 1);
+
+        // construct the element before moving the gap, since `args` may refer to an element of the list which the gap moves
+        T element(std::forward<Args>(args)...);
+        move_gap(index >= 0 ? index : index + size());
+        return front_.emplace_back(std::move(element));
+    }
+
+    /// Remove and return the `element` at the specified `index` in the list, and move the gap to its position.
+    /// Index can be negative.
+    T remove(int index)
+    {
+        detail::check_empty(size());
+        detail::check_bounds(index, -size(), size());
+
+        move_gap(index >= 0 ? index : index + size());
+        T element = std::move(back_.back());
+        back_.pop_back();
+
+        return element;
+    }
+
+    /// Erase the contents of the range [`start`, `stop`) of the list, and move the gap to `start`.
+    GapList& erase(int start, int stop)
+    {
+        detail::check_bounds(start, 0, size() + 1);
+        detail::check_bounds(stop, 0, size() + 1);
+
+        if (start < stop)
+        {
+            move_gap(start);
+            back_.erase(back_.end() - (stop - start), back_.end());
+        }
+
+        return *this;
+    }
+
+    /// Append the specified `element` to the end of the list.
+    GapList& operator+=(const T& element)
+    {
+        emplace(size(), element);
+
+        return *this;
+    }
+
+    /// Append the specified `element` to the end of the list, moving it.
+    GapList& operator+=(T&& element)
+    {
+        emplace(size(), std::move(element));
+
+        return *this;
+    }
+
+    /// Extend the specified `list` to the end of the list.
+    GapList& operator+=(const GapList& list)
+    {
+        detail::check_full(size() / 2 + list.size() / 2, INT_MAX / 2);
+
+        move_gap(size());
+        const int count = list.size(); // the list may be this list
+        front_.reserve(front_.size() + count);
+        for (int i = 0; i < count; ++i)
+        {
+            front_.push_back(list.at(i));
+        }
+
+        return *this;
+    }
+
+    /// Rotate the list to right `n` elements.
+    GapList& operator>>=(int n)
+    {
+        if (size() <= 1 || n == 0)
+        {
+            return *this;
+        }
+
+        if (n < 0)
+        {
+            return *this <<= -n;
+        }
+
+        return *this <<= size() - n;
+    }
+
+    /// Rotate the list to left `n` elements, and move the gap between the rotated parts.
+    GapList& operator<<=(int n)
+    {
+        if (size() <= 1 || n == 0)
+        {
+            return *this;
+        }
+
+        n %= size();
+
+        if (n < 0)
+        {
+            n += size();
+        }
+
+        // [A | B] with the gap at n is [A] + reversed [B], and becomes [B] + reversed [A]
+        move_gap(n);
+        front_.swap(back_);
+        std::reverse(front_.begin(), front_.end());
+        std::reverse(back_.begin(), back_.end());
+
+        return *this;
+    }
+
+    /// Reverse the list in place in O(1) time, by exchanging the two sides of the gap.
+    GapList& reverse()
+    {
+        front_.swap(back_);
+
+        return *this;
+    }
+
+    /// Remove all of the elements from the list.
+    void clear()
+    {
+        front_.clear();
+        back_.clear();
+    }
+
+    /*
+     * Production
+     */
+
+    /// Return slice of the list from `start` (included) to `stop` (excluded) with certain `step` (default 1).
+    /// Index and step length can be negative.
+    GapList slice(int start, int stop, int step = 1) const
+    {
+        if (step == 0)
+        {
+            throw std::runtime_error("Error: Require step != 0 for slice(start, stop, step).");
+        }
+
+        detail::check_bounds(start, -size(), size());
+        detail::check_bounds(stop, -size() - 1, size() + 1);
+
+        // convert
+        start = start < 0 ? start + size() : start;
+        stop = stop < 0 ? stop + size() : stop;
+
+        // copy
+        const int len = step > 0 ? (stop - start + step - 1) / step : (start - stop - step - 1) / -step;
+        GapList buffer;
+        buffer.front_.reserve(std::max(len, 0));
+        for (int i = start; (step > 0) ? (i < stop) : (i > stop); i += step)
+        {
+            buffer.front_.push_back(at(i));
+        }
+
+        return buffer;
+    }
+
+    /*
+     * Print
+     */
+
+    /// Output the list to the specified output stream.
+    friend std::ostream& operator<<(std::ostream& os, const GapList& list)
+    {
+        return detail::print(os, list.begin(), list.end(), '[', ']');
+    }
+};
+
+} // namespace pyincpp
+
+#endif // GAP_LIST_HPP
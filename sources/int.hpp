@@ -24,13 +24,16 @@ private:
     // Sign of integer, 1 is positive, -1 is negative, and 0 is zero.
     signed char sign_;
 
+    // Vector of chunks, allocated from a memory resource if the integer is in a `pmr` container, see `allocator_type`.
+    using Chunks = std::vector<int, detail::ResourceAllocator<int>>;
+
     // List of digits, represent absolute value of the integer, little endian.
     // Example: `123456789000`
     // ```
     // chunk: 456789000 123
     // index: 0         1
     // ```
-    std::vector<int> chunks_;
+    Chunks chunks_;
 
     // Remove leading zeros and correct sign.
     Int& trim()
@@ -145,7 +148,7 @@ private:
     }
 
     // Helper constructor.
-    Int(signed char sign, const std::vector<int>& chunks)
+    Int(signed char sign, const Chunks& chunks)
         : sign_(sign)
         , chunks_(chunks)
     {
@@ -189,6 +192,10 @@ private:
     }
 
 public:
+    /// Type of the allocator of the chunks.
+    /// The containers with a polymorphic allocator, like `pmr::List<Int>`, create the integers in their memory resource.
+    using allocator_type = detail::ResourceAllocator<int>;
+
     /*
      * Constructor
      */
@@ -245,13 +252,36 @@ public:
     Int(const Int& that) = default;
 
     /// Move constructor.
-    Int(Int&& that)
+    Int(Int&& that) noexcept
         : sign_(std::move(that.sign_))
         , chunks_(std::move(that.chunks_))
     {
         that.sign_ = 0;
     }
 
+    /// Create a copy of the integer with the chunks allocated by the `allocator`.
+    Int(std::allocator_arg_t, const allocator_type& allocator, const Int& that)
+        : sign_(that.sign_)
+        , chunks_(that.chunks_, allocator)
+    {
+    }
+
+    /// Move the integer into one with the chunks allocated by the `allocator`, the chunks are copied if the allocators differ.
+    Int(std::allocator_arg_t, const allocator_type& allocator, Int&& that)
+        : sign_(std::exchange(that.sign_, 0))
+        , chunks_(std::move(that.chunks_), allocator)
+    {
+        that.chunks_.clear();
+    }
+
+    /// Create an integer from the `args` like the other constructors, with the chunks allocated by the `allocator`.
+    template <typename... Args>
+        requires(!std::is_same_v<std::remove_cvref_t<Args>, Int> && ...)
+    Int(std::allocator_arg_t, const allocator_type& allocator, Args&&... args)
+        : Int(std::allocator_arg, allocator, Int(std::forward<Args>(args)...))
+    {
+    }
+
     /*
      * Comparison
      */
@@ -281,12 +311,14 @@ public:
     Int& operator=(const Int& that) = default;
 
     /// Move assignment operator.
+    /// The chunks are copied if the allocators differ, see `allocator_type`.
     Int& operator=(Int&& that)
     {
         sign_ = std::move(that.sign_);
         chunks_ = std::move(that.chunks_);
 
         that.sign_ = 0;
+        that.chunks_.clear();
 
         return *this;
     }
@@ -306,6 +338,12 @@ public:
         return (chunks_.size() - 1) * DIGITS_PER_CHUNK + std::floor(std::log10(chunks_.back())) + 1;
     }
 
+    /// Return the allocator of the chunks.
+    allocator_type get_allocator() const
+    {
+        return chunks_.get_allocator();
+    }
+
     /// Determine whether the integer is zero quickly.
     bool is_zero() const
     {
@@ -416,7 +454,7 @@ public:
         // now, the sign of two integers is the same and not zero
 
         // normalize
-        std::vector<int> rhs_digits = rhs.chunks_;
+        Chunks rhs_digits(rhs.chunks_, chunks_.get_allocator()); // same allocator as the chunks to swap with
         if (abs_cmp(rhs) == -1) // let a.len >= b.len
         {
             sign_ = -sign_;
@@ -456,7 +494,7 @@ public:
         // normalize
         const auto& a = chunks_;
         const auto& b = rhs.chunks_;
-        Int result(sign_ == rhs.sign_ ? 1 : -1, std::vector<int>(a.size() + b.size()));
+        Int result(sign_ == rhs.sign_ ? 1 : -1, Chunks(a.size() + b.size()));
         auto& c = result.chunks_;
 
         // calculate
@@ -837,7 +875,7 @@ public:
         std::mt19937 gen(std::random_device{}());
 
         // little chunks
-        auto chunks = std::vector<int>((digits - 1) / DIGITS_PER_CHUNK);
+        auto chunks = Chunks((digits - 1) / DIGITS_PER_CHUNK);
         std::uniform_int_distribution<int> chunk(0, BASE - 1);
         std::for_each(chunks.begin(), chunks.end(), [&](auto& x)
                       { x = chunk(gen); });
@@ -1003,6 +1041,8 @@ public:
     }
 
     friend struct std::hash<pyincpp::Int>;
+
+    friend class StrBuilder;
 };
 
 } // namespace pyincpp
@@ -1012,14 +1052,8 @@ struct std::hash<pyincpp::Int> // explicit specialization
 {
     std::size_t operator()(const pyincpp::Int& integer) const
     {
-        std::size_t value = std::hash<signed char>{}(integer.sign_);
-
-        for (const auto& d : integer.chunks_)
-        {
-            value ^= std::hash<int>{}(d) << 1;
-        }
-
-        return value;
+        // the chunks are hashed as a whole, so that the position of each chunk matters
+        return pyincpp::detail::hash_bytes(integer.chunks_.data(), integer.chunks_.size() * sizeof(int), pyincpp::detail::hash_seed() + integer.sign_);
     }
 };
 
@@ -0,0 +1,275 @@
+//! @file lazy.hpp
+//! @author Chen QingYu <chen_qingyu@qq.com>
+//! @brief Lazy template class.
+//! @date 2026.10.16
+
+#ifndef LAZY_HPP
+#define LAZY_HPP
+
+#include "detail.hpp"
+
+namespace pyincpp
+{
+
+template <typename T, std::size_t N, typename Allocator, bool Ring>
+class List;
+
+namespace detail
+{
+
+// View of a vector which shares the ownership of it, so that a pipeline over a temporary list can be copied.
+template <typename T>
+class SharedView : public std::ranges::view_interface<SharedView<T>>
+{
+private:
+    // Elements.
+    std::shared_ptr<const std::vector<T>> vector_;
+
+public:
+    SharedView() = default;
+
+    explicit SharedView(std::vector<T>&& vector)
+        : vector_(std::make_shared<const std::vector<T>>(std::move(vector)))
+    {
+    }
+
+    auto begin() const
+    {
+        return vector_->begin();
+    }
+
+    auto end() const
+    {
+        return vector_->end();
+    }
+};
+
+// Input view which caches the current element of the underlying view whose elements are computed (like of `map()`),
+// so that a later stage reading an element more than once (like `filter()`) does not compute it again.
+template <std::ranges::view V>
+class CacheView : public std::ranges::view_interface<CacheView<V>>
+{
+private:
+    using value_type = std::ranges::range_value_t<V>;
+
+    // Underlying view.
+    V base_;
+
+    // Current element, or empty if not computed yet.
+    std::optional<value_type> cache_;
+
+    class Iterator
+    {
+    private:
+        CacheView* parent_ = nullptr;
+        std::ranges::iterator_t<V> it_;
+
+    public:
+        using iterator_concept = std::input_iterator_tag;
+        using value_type = CacheView::value_type;
+        using difference_type = std::ranges::range_difference_t<V>;
+
+        Iterator() = default;
+
+        Iterator(CacheView* parent, std::ranges::iterator_t<V> it)
+            : parent_(parent)
+            , it_(std::move(it))
+        {
+        }
+
+        value_type& operator*() const
+        {
+            if (!parent_->cache_)
+            {
+                parent_->cache_.emplace(*it_);
+            }
+            return *parent_->cache_;
+        }
+
+        friend value_type&& iter_move(const Iterator& it)
+        {
+            return std::move(*it);
+        }
+
+        Iterator& operator++()
+        {
+            ++it_;
+            parent_->cache_.reset();
+            return *this;
+        }
+
+        void operator++(int)
+        {
+            ++*this;
+        }
+
+        friend bool operator==(const Iterator& it, const std::ranges::sentinel_t<V>& end)
+        {
+            return it.it_ == end;
+        }
+    };
+
+public:
+    CacheView() = default;
+
+    explicit CacheView(V base)
+        : base_(std::move(base))
+    {
+    }
+
+    Iterator begin()
+    {
+        cache_.reset();
+        return Iterator(this, std::ranges::begin(base_));
+    }
+
+    auto end()
+    {
+        return std::ranges::end(base_);
+    }
+};
+
+} // namespace detail
+
+/// Lazy is a pipeline of transformations over a sequence, which are fused into one pass and performed only when collected.
+///
+/// ### Example
+/// ```
+/// List<int> list = {1, 2, 3, 4, 5, 6};
+/// list.lazy().filter([](int x) { return x % 2 == 0; }).map([](int x) { return x * x; }).take(2).collect(); // [4, 16]
+/// list.lazy().map([](int x) { return x % 3; }).collect<Set<int>>(); // {0, 1, 2}
+/// ```
+template <std::ranges::view V>
+class Lazy
+{
+private:
+    // View of the pipeline.
+    V view_;
+
+    // Create a pipeline from the view.
+    template <std::ranges::view U>
+    static Lazy<U> make(U view)
+    {
+        return Lazy<U>(std::move(view));
+    }
+
+public:
+    /// Type of the elements which the pipeline produces.
+    using value_type = std::ranges::range_value_t<V>;
+
+    /*
+     * Constructor
+     */
+
+    /// Create a pipeline from the view.
+    explicit Lazy(V view)
+        : view_(std::move(view))
+    {
+    }
+
+    /*
+     * Iterator
+     */
+
+    /// Return an iterator to the first element of the pipeline.
+    auto begin()
+    {
+        return std::ranges::begin(view_);
+    }
+
+    /// Return an iterator to the element following the last element of the pipeline.
+    auto end()
+    {
+        return std::ranges::end(view_);
+    }
+
+    /*
+     * Production
+     */
+
+    /// Return a pipeline that transforms each element by the `function`, like Python's `map()`.
+    template <typename F>
+    auto map(F function) const
+    {
+        return make(V(view_) | std::views::transform(std::move(function)));
+    }
+
+    /// Return a pipeline that only keeps the elements that meet the `predicate`, like Python's `filter()`.
+    template <typename F>
+    auto filter(F predicate) const
+    {
+        if constexpr (std::is_reference_v<std::ranges::range_reference_t<V>>)
+        {
+            return make(V(view_) | std::views::filter(std::move(predicate)));
+        }
+        else // the elements are computed, cache them so they are computed only once
+        {
+            return make(detail::CacheView<V>(view_) | std::views::filter(std::move(predicate)));
+        }
+    }
+
+    /// Return a pipeline of the first `n` elements at most.
+    auto take(int n) const
+    {
+        if (n < 0)
+        {
+            throw std::runtime_error("Error: Require n >= 0 for take().");
+        }
+
+        return make(V(view_) | std::views::take(n));
+    }
+
+    /// Return a pipeline that skips the first `n` elements at most.
+    auto drop(int n) const
+    {
+        if (n < 0)
+        {
+            throw std::runtime_error("Error: Require n >= 0 for drop().");
+        }
+
+        return make(V(view_) | std::views::drop(n));
+    }
+
+    /// Return a pipeline of the leading elements that meet the `predicate`, like Python's `itertools.takewhile()`.
+    template <typename F>
+    auto take_while(F predicate) const
+    {
+        return make(V(view_) | std::views::take_while(std::move(predicate)));
+    }
+
+    /// Return a pipeline that skips the leading elements that meet the `predicate`, like Python's `itertools.dropwhile()`.
+    template <typename F>
+    auto drop_while(F predicate) const
+    {
+        return make(V(view_) | std::views::drop_while(std::move(predicate)));
+    }
+
+    /// Run the pipeline in one pass, and collect the elements into a container (List by default).
+    /// The container can be any type that is constructible from std::vector or from a range of iterators, like Set and Dict.
+    template <typename C = List<value_type, 0, void, false>>
+    C collect()
+    {
+        std::vector<value_type> buffer;
+        if constexpr (std::ranges::sized_range<V>)
+        {
+            buffer.reserve(std::ranges::size(view_));
+        }
+        for (auto it = std::ranges::begin(view_); it != std::ranges::end(view_); ++it)
+        {
+            buffer.emplace_back(std::ranges::iter_move(it));
+        }
+
+        if constexpr (std::is_constructible_v<C, std::vector<value_type>&&>)
+        {
+            return C(std::move(buffer));
+        }
+        else
+        {
+            return C(std::make_move_iterator(buffer.begin()), std::make_move_iterator(buffer.end()));
+        }
+    }
+};
+
+} // namespace pyincpp
+
+#endif // LAZY_HPP
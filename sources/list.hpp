@@ -8,41 +8,219 @@
 
 #include "detail.hpp"
 
+#include "lazy.hpp"
+
 namespace pyincpp
 {
 
 /// List is collection of homogeneous objects.
-template <typename T>
+/// If `N` > 0, up to `N` elements are stored inside the list object without heap allocation, see `SmallList`.
+/// The memory is allocated by `Allocator` (std::allocator if void), see `pmr::List` for lists in an `Arena`.
+/// If `Ring` is `true`, the list is rotated in O(1) time by a start offset over its storage, see `RingList`.
+template <typename T, std::size_t N = 0, typename Allocator = void, bool Ring = false>
 class List
 {
+    static_assert(N == 0 || std::is_void_v<Allocator>, "SmallList uses the default allocator");
+
 private:
-    // Vector.
-    std::vector<T> vector_;
+    // Storage of the elements.
+    using Vector = std::conditional_t<N == 0, std::vector<T, detail::allocator_of<T, Allocator>>, detail::SmallVector<T, N>>;
+
+    // Vector, the elements of a RingList are rotated lazily over it as a ring, see `materialize()`.
+    Vector vector_;
+
+    // Start offset of the lazy rotations, always 0 and empty unless `Ring`.
+    [[no_unique_address]] detail::OffsetOf<Ring> offset_;
+
+    // Move the elements to their logical positions after the lazy rotations, so that the vector is in order.
+    // It takes O(N) time once after rotations, the non-const members which modify the vector call it first.
+    void materialize()
+    {
+        if (offset_.start != 0)
+        {
+            std::rotate(vector_.begin(), vector_.begin() + offset_.start, vector_.end());
+            offset_ = {};
+        }
+    }
+
+    // Return `f(first, last)` with the iterators to the elements in order: of the vector if it is not rotated,
+    // so that the algorithms run on contiguous memory, or ring iterators otherwise.
+    template <typename F>
+    decltype(auto) with_range(const F& f) const
+    {
+        if constexpr (Ring)
+        {
+            if (offset_.start != 0)
+            {
+                return f(begin(), end());
+            }
+        }
+
+        return f(vector_.begin(), vector_.end());
+    }
+
+    // Create a list from the storage, moving the elements.
+    List(Vector&& vector)
+        requires(!std::is_same_v<Vector, std::vector<T>>)
+        : vector_(std::move(vector))
+    {
+    }
+
+    // Convert std::vector to the storage allocated by the `allocator`, moving the elements.
+    static Vector from_vector(std::vector<T>&& vector, const detail::allocator_of<T, Allocator>& allocator)
+    {
+        if constexpr (std::is_same_v<Vector, std::vector<T>>)
+        {
+            return std::move(vector);
+        }
+        else
+        {
+            return Vector(std::make_move_iterator(vector.begin()), std::make_move_iterator(vector.end()), allocator);
+        }
+    }
+
+    // Stable sort the items by the comparator on their projections, swapping the arguments keeps it stable when reversed.
+    // Integers, floating-point numbers and strings in the default order are sorted by radix sort.
+    template <typename Items, typename Proj, typename Compare>
+    static void sort_items(Items& items, Proj proj, Compare& comparator, bool reverse, bool parallel)
+    {
+        using U = typename Items::value_type;
+
+        if constexpr (std::is_same_v<Compare, std::less<>> && detail::radix_sortable<std::decay_t<std::invoke_result_t<Proj&, const U&>>>)
+        {
+            if (items.size() >= detail::RADIX_THRESHOLD)
+            {
+                detail::radix_sort(items, proj, reverse);
+                return;
+            }
+        }
+
+        auto sort = [&](auto comp)
+        {
+            parallel ? detail::parallel_stable_sort(items.begin(), items.end(), comp) : std::stable_sort(items.begin(), items.end(), comp);
+        };
+
+        if (reverse)
+        {
+            sort([&](const U& e1, const U& e2)
+                 { return comparator(proj(e2), proj(e1)); });
+        }
+        else
+        {
+            sort([&](const U& e1, const U& e2)
+                 { return comparator(proj(e1), proj(e2)); });
+        }
+    }
+
+    // Sort the list by the comparator.
+    template <typename Compare>
+    void sort_with(Compare& comparator, bool reverse, bool parallel)
+    {
+        materialize();
+        sort_items(vector_, std::identity(), comparator, reverse, parallel);
+    }
+
+    // Reduce each chunk of the list by the function in parallel, starting from the first element of the chunk.
+    template <typename F>
+    std::vector<std::optional<T>> reduce_chunks(const F& function) const
+    {
+        const detail::ParallelChunks chunks(vector_.size());
+        std::vector<std::optional<T>> partials(chunks.count);
+        with_range([&](auto first, auto)
+                   { detail::parallel_for(chunks.count, [&](int c)
+                                          {
+                                              T result = first[chunks.begin(c)];
+                                              for (std::size_t i = chunks.begin(c) + 1; i < chunks.end(c); ++i)
+                                              {
+                                                  result = function(std::move(result), first[i]);
+                                              }
+                                              partials[c] = std::move(result);
+                                          }); });
+
+        return partials;
+    }
+
+    // Sort the list by the keys (decorate-sort-undecorate).
+    template <typename Key>
+    void sort_by(Key& key, bool reverse, bool parallel)
+    {
+        using K = std::decay_t<std::invoke_result_t<Key&, const T&>>;
+
+        materialize();
+        std::vector<std::pair<K, int>> decorated;
+        decorated.reserve(vector_.size());
+        for (int i = 0; i < size(); ++i)
+        {
+            decorated.emplace_back(std::invoke(key, vector_[i]), i);
+        }
+
+        std::less<> less;
+        sort_items(decorated, [](const std::pair<K, int>& p) -> const K&
+                   { return p.first; }, less, reverse, parallel);
+
+        Vector sorted(vector_.get_allocator());
+        sorted.reserve(vector_.size());
+        for (const auto& pair : decorated)
+        {
+            sorted.push_back(std::move(vector_[pair.second]));
+        }
+        vector_ = std::move(sorted);
+    }
 
 public:
     /*
      * Constructor
      */
 
+    /// Type of the allocator.
+    /// The containers with a polymorphic allocator pass their memory resource on to the `pmr::List` elements.
+    using allocator_type = detail::allocator_of<T, Allocator>;
+
     /// Create an empty list.
     List() = default;
 
+    /// Create an empty list which allocates by the `allocator`, like `pmr::List<int>(&arena)`.
+    explicit List(const allocator_type& allocator)
+        : vector_(allocator)
+    {
+    }
+
     /// Create a list with the contents of the initializer list `init`.
-    List(const std::initializer_list<T>& init)
-        : vector_(init)
+    List(const std::initializer_list<T>& init, const allocator_type& allocator = allocator_type())
+        : vector_(init, allocator)
     {
     }
 
     /// Create a list with the contents of the range [`first`, `last`).
     template <std::input_iterator InputIt>
-    List(const InputIt& first, const InputIt& last)
-        : vector_(first, last)
+    List(const InputIt& first, const InputIt& last, const allocator_type& allocator = allocator_type())
+        : vector_(first, last, allocator)
     {
     }
 
     /// Create a list from std::vector.
-    List(const std::vector<T>& vector)
-        : vector_(vector)
+    List(const std::vector<T>& vector, const allocator_type& allocator = allocator_type())
+        : vector_(vector.begin(), vector.end(), allocator)
+    {
+    }
+
+    /// Create a list from std::vector, moving the elements.
+    List(std::vector<T>&& vector, const allocator_type& allocator = allocator_type())
+        : vector_(from_vector(std::move(vector), allocator))
+    {
+    }
+
+    /// Create a copy of the list which allocates by the `allocator`.
+    List(const List& that, const allocator_type& allocator)
+        : vector_(that.vector_, allocator)
+        , offset_(that.offset_)
+    {
+    }
+
+    /// Move the list into one which allocates by the `allocator`, the elements are moved one by one if the allocators differ.
+    List(List&& that, const allocator_type& allocator)
+        : vector_(std::move(that.vector_), allocator)
+        , offset_(std::move(that.offset_))
     {
     }
 
@@ -50,35 +228,63 @@ public:
      * Comparison
      */
 
+    /// Check whether two lists are equal.
+    bool operator==(const List& that) const
+    {
+        return with_range([&](auto first1, auto last1)
+                          { return that.with_range([&](auto first2, auto last2)
+                                                   { return std::equal(first1, last1, first2, last2); }); });
+    }
+
     /// Compare the list with another list.
-    auto operator<=>(const List& that) const = default;
+    auto operator<=>(const List& that) const
+    {
+        return with_range([&](auto first1, auto last1)
+                          { return that.with_range([&](auto first2, auto last2)
+                                                   { return std::lexicographical_compare_three_way(first1, last1, first2, last2, detail::synth_three_way<T>); }); });
+    }
 
     /*
      * Iterator
      */
 
     /// Return an iterator to the first element of the list.
+    /// The iterators of a RingList map the index through the start offset of the lazy rotations, see `RingList`.
     auto begin() const
     {
-        return vector_.begin();
+        if constexpr (Ring)
+        {
+            return detail::RingIterator<Vector>(vector_, offset_.start, 0);
+        }
+        else
+        {
+            return vector_.begin();
+        }
     }
 
     /// Return an iterator to the element following the last element of the list.
     auto end() const
     {
-        return vector_.end();
+        if constexpr (Ring)
+        {
+            return detail::RingIterator<Vector>(vector_, offset_.start, vector_.size());
+        }
+        else
+        {
+            return vector_.end();
+        }
     }
 
     /// Return a reverse iterator to the first element of the reversed list.
     auto rbegin() const
     {
-        return vector_.rbegin();
+        return std::make_reverse_iterator(end());
     }
 
     /// Return a reverse iterator to the element following the last element of the reversed list.
     auto rend() const
     {
-        return vector_.rend();
+        return std::make_reverse_iterator(begin());
     }
 
     /*
@@ -91,7 +297,7 @@ public:
     {
         detail::check_bounds(index, -size(), size());
 
-        return vector_[index >= 0 ? index : index + size()];
+        return vector_[offset_.position(index >= 0 ? index : index + size(), size())];
     }
 
     /// Return the const reference to element at the specified position in the list.
@@ -117,18 +323,28 @@ public:
         return vector_.empty();
     }
 
+    /// Return the allocator of the list.
+    allocator_type get_allocator() const
+    {
+        return vector_.get_allocator();
+    }
+
     /// Return the iterator of the specified element in the list, or end() if the list does not contain the element.
     auto find(const T& element) const
     {
-        return std::find(begin(), end(), element);
+        return begin() + with_range([&](auto first, auto last)
+                                    { return std::find(first, last, element) - first; });
     }
 
     /// Return the index of the first occurrence of the specified `element`, or -1 if the list does not contain the element in the specified range [`start`, `stop`].
     int index(const T& element, int start = 0, int stop = INT_MAX) const
     {
         stop = stop > size() ? size() : stop;
-        auto it = std::find(begin() + start, begin() + stop, element);
-        return it == begin() + stop ? -1 : it - begin();
+        return with_range([&](auto first, auto)
+                          {
+                              auto it = std::find(first + start, first + stop, element);
+                              return it == first + stop ? -1 : int(it - first);
+                          });
     }
 
     /// Return `true` if the list contains the specified `element` in the specified range [`start`, `stop`].
@@ -140,7 +356,93 @@ public:
     /// Count the total number of occurrences of the specified `element` in the list.
     int count(const T& element) const
     {
-        return std::count(begin(), end(), element);
+        return std::count(vector_.begin(), vector_.end(), element); // the order does not matter
+    }
+
+    /// Same as `find()` but the list is searched in multiple threads.
+    auto par_find(const T& element) const
+    {
+        return par_find([&](const T& e)
+                        { return e == element; });
+    }
+
+    /// Return the iterator of the first element that meets the `predicate`, or end() if there is no such element.
+    /// The list is searched in chunks in multiple threads, the chunks after a found element are skipped.
+    template <typename F>
+        requires std::predicate<const F&, const T&>
+    auto par_find(const F& predicate) const
+    {
+        const detail::ParallelChunks chunks(vector_.size());
+        std::atomic<std::size_t> found = vector_.size();
+        with_range([&](auto first, auto)
+                   { detail::parallel_for(chunks.count, [&](int c)
+                                          {
+                                              for (std::size_t i = chunks.begin(c); i < chunks.end(c) && i < found.load(std::memory_order_relaxed); ++i)
+                                              {
+                                                  if (predicate(first[i]))
+                                                  {
+                                                      for (std::size_t f = found.load(); i < f && !found.compare_exchange_weak(f, i);)
+                                                      {
+                                                      }
+                                                      return;
+                                                  }
+                                              }
+                                          }); });
+
+        return begin() + found.load();
+    }
+
+    /// Same as `count()` but the list is counted in multiple threads.
+    int par_count(const T& element) const
+    {
+        return par_count([&](const T& e)
+                         { return e == element; });
+    }
+
+    /// Count the number of elements that meet the `predicate` in multiple threads.
+    template <typename F>
+        requires std::predicate<const F&, const T&>
+    int par_count(const F& predicate) const
+    {
+        // the order does not matter, so the chunks are counted in the vector
+        const detail::ParallelChunks chunks(vector_.size());
+        std::vector<int> counts(chunks.count);
+        detail::parallel_for(chunks.count, [&](int c)
+                             { counts[c] = std::count_if(vector_.begin() + chunks.begin(c), vector_.begin() + chunks.end(c), predicate); });
+
+        return std::reduce(counts.begin(), counts.end());
+    }
+
+    /// Apply the `function` of two arguments cumulatively to the elements of the list, like Python's `functools.reduce()`.
+    /// The chunks of the list are reduced in multiple threads, and then the partial results in order,
+    /// so the `function` must be associative, like `+`, `*`, `min` and `max`.
+    template <typename F>
+    T par_reduce(const F& function) const
+    {
+        detail::check_empty(size());
+
+        auto partials = reduce_chunks(function);
+        T result = std::move(*partials[0]);
+        for (std::size_t c = 1; c < partials.size(); ++c)
+        {
+            result = function(std::move(result), std::move(*partials[c]));
+        }
+
+        return result;
+    }
+
+    /// Apply the `function` of two arguments cumulatively to the `initial` value and the elements of the list, like Python's `functools.reduce()`.
+    /// The `function` must be associative, see `par_reduce(function)`.
+    template <typename F>
+    T par_reduce(const F& function, const T& initial) const
+    {
+        T result = initial;
+        for (auto& partial : reduce_chunks(function))
+        {
+            result = function(std::move(result), std::move(*partial));
+        }
+
+        return result;
     }
 
     /*
@@ -150,12 +452,50 @@ public:
     /// Insert the specified `element` at the specified `index` in the list.
     /// Index can be negative.
     void insert(int index, const T& element)
+    {
+        emplace(index, element);
+    }
+
+    /// Insert the specified `element` at the specified `index` in the list, moving it.
+    /// Index can be negative.
+    void insert(int index, T&& element)
+    {
+        emplace(index, std::move(element));
+    }
+
+    /// Insert an element constructed in place from `args` at the specified `index` in the list, and return a reference to it.
+    /// Index can be negative.
+    template <typename... Args>
+    decltype(auto) emplace(int index, Args&&... args)
     {
         detail::check_full(size(), INT_MAX);
         detail::check_bounds(index, -size(), size() + 1);
 
         index = index >= 0 ? index : index + size();
-        vector_.insert(begin() + index, element);
+        if (offset_.start != 0)
+        {
+            // construct the element before the rotation moves the elements, since `args` may refer to one of them
+            T element(std::forward<Args>(args)...);
+            materialize();
+            return *vector_.emplace(vector_.begin() + index, std::move(element));
+        }
+        return *vector_.emplace(vector_.begin() + index, std::forward<Args>(args)...);
+    }
+
+    /// Append an element constructed in place from `args` to the end of the list, and return a reference to it.
+    template <typename... Args>
+    decltype(auto) emplace_back(Args&&... args)
+    {
+        detail::check_full(size(), INT_MAX);
+
+        if (offset_.start != 0)
+        {
+            // construct the element before the rotation moves the elements, since `args` may refer to one of them
+            T element(std::forward<Args>(args)...);
+            materialize();
+            return vector_.emplace_back(std::move(element));
+        }
+        return vector_.emplace_back(std::forward<Args>(args)...);
     }
 
     /// Remove and return the `element` at the specified `index` in the list.
@@ -166,8 +506,9 @@ public:
         detail::check_bounds(index, -size(), size());
 
         index = index >= 0 ? index : index + size();
+        materialize();
         T element = std::move(vector_[index]);
-        vector_.erase(begin() + index);
+        vector_.erase(vector_.begin() + index);
 
         return element;
     }
@@ -175,9 +516,15 @@ public:
     /// Append the specified `element` to the end of the list.
     List& operator+=(const T& element)
     {
-        detail::check_full(size(), INT_MAX);
+        emplace_back(element);
+
+        return *this;
+    }
 
-        vector_.push_back(element);
+    /// Append the specified `element` to the end of the list, moving it.
+    List& operator+=(T&& element)
+    {
+        emplace_back(std::move(element));
 
         return *this;
     }
@@ -187,7 +534,28 @@ public:
     {
         detail::check_full(size() / 2 + list.size() / 2, INT_MAX / 2);
 
-        vector_.insert(end(), list.begin(), list.end());
+        materialize();
+        list.with_range([&](auto first, auto last)
+                        { vector_.insert(vector_.end(), first, last); });
+
+        return *this;
+    }
+
+    /// Extend the specified `list` to the end of the list, moving its elements.
+    List& operator+=(List&& list)
+    {
+        detail::check_full(size() / 2 + list.size() / 2, INT_MAX / 2);
+
+        materialize();
+        list.materialize();
+        if (vector_.empty() && vector_.capacity() < list.vector_.capacity() && vector_.get_allocator() == list.vector_.get_allocator())
+        {
+            vector_.swap(list.vector_);
+        }
+        else
+        {
+            vector_.insert(vector_.end(), std::make_move_iterator(list.vector_.begin()), std::make_move_iterator(list.vector_.end()));
+        }
 
         return *this;
     }
@@ -195,9 +563,11 @@ public:
     /// Remove the first occurrence of the specified element from the list.
     List& operator-=(const T& element)
     {
-        if (auto it = std::find(begin(), end(), element); it != end())
+        // find before the rotation moves the elements, since `element` may refer to one of them
+        if (int i = index(element); i != -1)
         {
-            vector_.erase(it);
+            materialize();
+            vector_.erase(vector_.begin() + i);
         }
 
         return *this;
@@ -212,12 +582,21 @@ public:
     /// Remove all the specified `element`s from the list.
     List& operator/=(const T& element)
     {
+        if (offset_.start != 0)
+        {
+            // copy before the rotation moves the elements, since `element` may refer to one of them
+            const T copy = element;
+            materialize();
+            return *this /= copy;
+        }
+
         auto it = std::remove(vector_.begin(), vector_.end(), element);
         vector_.erase(it, vector_.end());
         return *this;
     }
 
     /// Rotate the list to right `n` elements.
+    /// It takes O(N) time, or O(1) time for a RingList, see `RingList`.
     List& operator>>=(int n)
     {
         if (size() <= 1 || n == 0)
@@ -234,6 +613,7 @@ public:
     }
 
     /// Rotate the list to left `n` elements.
+    /// It takes O(N) time, or O(1) time for a RingList, see `RingList`.
     List& operator<<=(int n)
     {
         if (size() <= 1 || n == 0)
@@ -248,7 +628,14 @@ public:
             n += size();
         }
 
-        std::rotate(vector_.begin(), vector_.begin() + n, vector_.end());
+        if constexpr (Ring)
+        {
+            offset_.rotate(n, size());
+        }
+        else
+        {
+            std::rotate(vector_.begin(), vector_.begin() + n, vector_.end());
+        }
 
         return *this;
     }
@@ -256,6 +643,7 @@ public:
     /// Reverse the list in place.
     List& reverse()
     {
+        materialize();
         std::reverse(vector_.begin(), vector_.end());
 
         return *this;
@@ -263,27 +651,125 @@ public:
 
     /// Eliminate duplicate elements of the list.
     /// Will not change the original relative order of elements.
+    /// It takes O(N) time if `std::hash<T>` is available, O(N log N) time if T has `operator<`, or O(N^2) time otherwise.
     List& uniquify()
     {
-        std::vector<T> buffer;
-        for (auto&& e : vector_)
+        materialize();
+        if constexpr (detail::hashable<T>)
+        {
+            // open addressing table of the indices of the kept elements, at most half full
+            const std::size_t mask = std::bit_ceil(2 * vector_.size() + 1) - 1;
+            std::vector<int> table(mask + 1, -1);
+            int kept = 0;
+            for (int i = 0; i < size(); ++i)
+            {
+                std::size_t pos = detail::hash_word(std::hash<T>()(vector_[i])) & mask; // mix for weak hashes like std::hash<int>
+                while (table[pos] != -1 && !(vector_[table[pos]] == vector_[i]))
+                {
+                    pos = (pos + 1) & mask;
+                }
+                if (table[pos] == -1)
+                {
+                    table[pos] = kept;
+                    if (kept != i)
+                    {
+                        vector_[kept] = std::move(vector_[i]);
+                    }
+                    ++kept;
+                }
+            }
+            vector_.erase(vector_.begin() + kept, vector_.end());
+        }
+        else if constexpr (detail::less_comparable<T>)
+        {
+            // stable sort the indices by the elements, so the first occurrence leads each run of equal elements
+            std::vector<int> order(vector_.size());
+            std::iota(order.begin(), order.end(), 0);
+            std::stable_sort(order.begin(), order.end(), [&](int a, int b)
+                             { return vector_[a] < vector_[b]; });
+
+            std::vector<bool> keep(vector_.size(), false);
+            for (std::size_t i = 0, first = 0; i < order.size(); ++i)
+            {
+                if (i == 0 || !(vector_[order[first]] == vector_[order[i]]))
+                {
+                    keep[order[i]] = true;
+                    first = i;
+                }
+            }
+
+            int kept = 0;
+            for (int i = 0; i < size(); ++i)
+            {
+                if (keep[i])
+                {
+                    if (kept != i)
+                    {
+                        vector_[kept] = std::move(vector_[i]);
+                    }
+                    ++kept;
+                }
+            }
+            vector_.erase(vector_.begin() + kept, vector_.end());
+        }
+        else
         {
-            if (std::find(buffer.begin(), buffer.end(), e) == buffer.end())
+            Vector buffer(vector_.get_allocator());
+            for (auto&& e : vector_)
             {
-                buffer.push_back(e);
+                if (std::find(buffer.begin(), buffer.end(), e) == buffer.end())
+                {
+                    buffer.push_back(e);
+                }
             }
+            vector_ = std::move(buffer);
         }
-        vector_ = std::move(buffer);
 
         return *this;
     }
 
-    /// Sort the list according to the order induced by the specified comparator.
-    /// The sort is stable: the method will not reorder equal elements.
-    List& sort(bool (*comparator)(const T& e1, const T& e2) = [](const T& e1, const T& e2)
-               { return e1 < e2; })
+    /// Sort the list according to the order induced by the specified comparator (`<` by default), or reversed if `reverse` is `true`.
+    /// The sort is stable: the method will not reorder equal elements, even reversed.
+    /// Use `sort({}, true)` to sort from large to small.
+    /// Integers, floating-point numbers and strings in the default order are sorted by radix sort in O(N) time.
+    template <typename Compare = std::less<>>
+        requires std::predicate<Compare&, const T&, const T&>
+    List& sort(Compare comparator = {}, bool reverse = false)
     {
-        std::stable_sort(vector_.begin(), vector_.end(), comparator);
+        sort_with(comparator, reverse, false);
+
+        return *this;
+    }
+
+    /// Sort the list by the keys which the `key` function returns, like Python's `list.sort(key=..., reverse=...)`.
+    /// The key is computed only once for each element. The sort is stable, and uses radix sort for number and string keys.
+    template <typename Key>
+        requires std::invocable<Key&, const T&> && (!std::predicate<Key&, const T&, const T&>)
+    List& sort(Key key, bool reverse = false)
+    {
+        sort_by(key, reverse, false);
+
+        return *this;
+    }
+
+    /// Same as `sort()` but the list is sorted in multiple threads if it is large enough.
+    /// The comparator must be safe to call concurrently.
+    template <typename Compare = std::less<>>
+        requires std::predicate<Compare&, const T&, const T&>
+    List& parallel_sort(Compare comparator = {}, bool reverse = false)
+    {
+        sort_with(comparator, reverse, true);
+
+        return *this;
+    }
+
+    /// Same as `sort(key, reverse)` but the list is sorted in multiple threads if it is large enough.
+    /// The key function must be safe to call concurrently.
+    template <typename Key>
+        requires std::invocable<Key&, const T&> && (!std::predicate<Key&, const T&, const T&>)
+    List& parallel_sort(Key key, bool reverse = false)
+    {
+        sort_by(key, reverse, true);
 
         return *this;
     }
@@ -294,6 +780,7 @@ public:
         detail::check_bounds(start, 0, size() + 1);
         detail::check_bounds(stop, 0, size() + 1);
 
+        materialize();
         vector_.erase(vector_.begin() + start, vector_.begin() + stop);
 
         return *this;
@@ -303,6 +790,7 @@ public:
     template <typename F>
     List& map(const F& action)
     {
+        materialize();
         std::for_each(vector_.begin(), vector_.end(), action);
 
         return *this;
@@ -312,16 +800,75 @@ public:
     template <typename F>
     List& filter(const F& predicate)
     {
+        materialize();
         auto it = std::copy_if(vector_.begin(), vector_.end(), vector_.begin(), predicate);
         vector_.erase(it, vector_.end());
 
         return *this;
     }
 
+    /// Same as `map()` but the `action` is performed on the chunks of the list in multiple threads.
+    template <typename F>
+    List& par_map(const F& action)
+    {
+        materialize();
+        const detail::ParallelChunks chunks(vector_.size());
+        detail::parallel_for(chunks.count, [&](int c)
+                             { std::for_each(vector_.begin() + chunks.begin(c), vector_.begin() + chunks.end(c), action); });
+
+        return *this;
+    }
+
+    /// Same as `filter()` but the `predicate` is tested on the chunks of the list in multiple threads.
+    /// The retained elements keep their order: each chunk is compacted in parallel, and then moved to the offset of the chunk,
+    /// which is the prefix sum of the numbers of the retained elements of the chunks before it.
+    template <typename F>
+    List& par_filter(const F& predicate)
+    {
+        materialize();
+        const detail::ParallelChunks chunks(vector_.size());
+        std::vector<std::size_t> kept(chunks.count);
+        auto rejected = [&](auto&& e) // the elements of List<bool> are proxies
+        { return !predicate(e); };
+        detail::parallel_for(chunks.count, [&](int c)
+                             {
+                                 auto first = vector_.begin() + chunks.begin(c);
+                                 kept[c] = std::remove_if(first, vector_.begin() + chunks.end(c), rejected) - first;
+                             });
+
+        std::size_t offset = 0;
+        for (int c = 0; c < chunks.count; ++c)
+        {
+            auto first = vector_.begin() + chunks.begin(c);
+            if (offset != chunks.begin(c))
+            {
+                std::move(first, first + kept[c], vector_.begin() + offset);
+            }
+            offset += kept[c];
+        }
+        vector_.erase(vector_.begin() + offset, vector_.end());
+
+        return *this;
+    }
+
     /// Extend the list by appending elements of the range [`first`, `last`).
+    /// The list grows at most once if the range can be measured without consuming it (forward iterators).
     template <std::input_iterator InputIt>
     void extend(const InputIt& first, const InputIt& last)
     {
+        if constexpr (std::forward_iterator<InputIt>)
+        {
+            const auto count = std::distance(first, last);
+            detail::check_full(int(std::min<std::ptrdiff_t>(size() + count, INT_MAX)), INT_MAX);
+
+            // keep the geometric growth, so that repeated extends stay amortized O(1) per element
+            if (size() + count > int(vector_.capacity()))
+            {
+                vector_.reserve(std::max<std::size_t>(size() + count, vector_.capacity() * 2));
+            }
+        }
+
+        materialize();
         vector_.insert(vector_.end(), first, last);
     }
 
@@ -329,12 +876,34 @@ public:
     void clear()
     {
         vector_.clear();
+        offset_ = {};
     }
 
     /*
      * Production
      */
 
+    /// Return a lazy pipeline over the elements of the list, see `Lazy`.
+    /// The list must outlive the pipeline.
+    auto lazy() const&
+    {
+        return Lazy(std::ranges::subrange(begin(), end()));
+    }
+
+    /// Return a lazy pipeline which owns the elements of the temporary list, see `Lazy`.
+    auto lazy() &&
+    {
+        materialize();
+        if constexpr (std::is_same_v<Vector, std::vector<T>>)
+        {
+            return Lazy(detail::SharedView<T>(std::move(vector_)));
+        }
+        else
+        {
+            return Lazy(detail::SharedView<T>(std::vector<T>(std::make_move_iterator(vector_.begin()), std::make_move_iterator(vector_.end()))));
+        }
+    }
+
     /// Return slice of the list from `start` (included) to `stop` (excluded) with certain `step` (default 1).
     /// Index and step length can be negative.
     List slice(int start, int stop, int step = 1) const
@@ -352,31 +921,89 @@ public:
         stop = stop < 0 ? stop + size() : stop;
 
         // copy
-        std::vector<T> buffer;
-        for (int i = start; (step > 0) ? (i < stop) : (i > stop); i += step)
-        {
-            buffer.push_back(vector_[i]);
-        }
-
-        return buffer;
+        return with_range([&](auto first, auto)
+                          {
+                              if (step == 1)
+                              {
+                                  return start < stop ? Vector(first + start, first + stop, vector_.get_allocator()) : Vector(vector_.get_allocator());
+                              }
+                              if (step == -1)
+                              {
+                                  return start > stop ? Vector(std::make_reverse_iterator(first + start + 1), std::make_reverse_iterator(first + stop + 1), vector_.get_allocator()) : Vector(vector_.get_allocator());
+                              }
+
+                              const int len = step > 0 ? (stop - start + step - 1) / step : (start - stop - step - 1) / -step;
+                              Vector buffer(vector_.get_allocator());
+                              buffer.reserve(std::max(len, 0));
+                              for (int i = start; (step > 0) ? (i < stop) : (i > stop); i += step)
+                              {
+                                  buffer.push_back(first[i]);
+                              }
+
+                              return buffer;
+                          });
     }
 
     /// Generate a new list and append the specified `element` to the end of the list.
     List operator+(const T& element) const
     {
-        return List(*this) += element;
+        detail::check_full(size(), INT_MAX);
+
+        Vector buffer(vector_.get_allocator());
+        buffer.reserve(size() + 1);
+        with_range([&](auto first, auto last)
+                   { buffer.insert(buffer.end(), first, last); });
+        buffer.push_back(element);
+
+        return buffer;
     }
 
     /// Generate a new list and extend the specified `list` to the end of the list.
-    List operator+(const List& list) const
+    List operator+(const List& list) const&
     {
-        return List(*this) += list;
+        detail::check_full(size() / 2 + list.size() / 2, INT_MAX / 2);
+
+        Vector buffer(vector_.get_allocator());
+        buffer.reserve(size() + list.size());
+        with_range([&](auto first, auto last)
+                   { buffer.insert(buffer.end(), first, last); });
+        list.with_range([&](auto first, auto last)
+                        { buffer.insert(buffer.end(), first, last); });
+
+        return buffer;
+    }
+
+    /// Generate a new list and extend the specified `list` to the end of the list, moving the elements of it.
+    List operator+(List&& list) const&
+    {
+        detail::check_full(size() / 2 + list.size() / 2, INT_MAX / 2);
+
+        Vector buffer(vector_.get_allocator());
+        buffer.reserve(size() + list.size());
+        with_range([&](auto first, auto last)
+                   { buffer.insert(buffer.end(), first, last); });
+        list.materialize();
+        buffer.insert(buffer.end(), std::make_move_iterator(list.vector_.begin()), std::make_move_iterator(list.vector_.end()));
+
+        return buffer;
+    }
+
+    /// Extend the specified `list` to the end of the temporary list and return it, so that `a + b + c` copies each element once.
+    List operator+(const List& list) &&
+    {
+        return std::move(*this += list);
+    }
+
+    /// Extend the specified `list` to the end of the temporary list and return it, moving the elements of both lists.
+    List operator+(List&& list) &&
+    {
+        return std::move(*this += std::move(list));
     }
 
     /// Generate a new list and remove the first occurrence of the specified `element` from the list.
     List operator-(const T& element) const
     {
-        return List(*this) -= element;
+        return List(*this, vector_.get_allocator()) -= element;
     }
 
     /// Generate a new list and add the list to itself a certain number of `times`.
@@ -389,11 +1016,15 @@ public:
 
         detail::check_full(size() * times, INT_MAX);
 
-        std::vector<T> buffer(size() * times);
-        for (int part = 0; part < times; part++)
-        {
-            std::copy(begin(), end(), buffer.begin() + size() * part);
-        }
+        Vector buffer(vector_.get_allocator());
+        buffer.reserve(size() * times);
+        with_range([&](auto first, auto last)
+                   {
+                       for (int part = 0; part < times; part++)
+                       {
+                           buffer.insert(buffer.end(), first, last);
+                       }
+                   });
 
         return buffer;
     }
@@ -401,7 +1032,7 @@ public:
     /// Generate a new list and remove all the specified `elements` from the list.
     List operator/(const T& element) const
     {
-        return List(*this) /= element;
+        return List(*this, vector_.get_allocator()) /= element;
     }
 
     /*
@@ -411,10 +1042,46 @@ public:
     /// Output the list to the specified output stream.
     friend std::ostream& operator<<(std::ostream& os, const List& list)
     {
-        return detail::print(os, list.begin(), list.end(), '[', ']');
+        return list.with_range([&](auto first, auto last) -> std::ostream&
+                               { return detail::print(os, first, last, '[', ']'); });
     }
 };
 
+/// SmallList is a List which stores up to `N` elements inside the object, and moves them to the heap only when it grows beyond that.
+/// It saves the allocations of the many short lists, like the fields of a record or the tokens of a line.
+///
+/// ### Example
+/// ```
+/// SmallList<Str, 8> fields = {"id", "name", "age"}; // no heap allocation for the list
+/// fields += "email"; // still inline
+/// ```
+template <typename T, std::size_t N = 8>
+using SmallList = List<T, N>;
+
+/// RingList is a List which is rotated in O(1) time: it keeps a start offset over its storage, and indexing stays O(1).
+/// It suits the sliding windows over a buffer, which rotate it by small amounts many times.
+/// The const members read the elements in place, through ring iterators after rotations, and the elements are moved in O(N) time
+/// only when a non-const member which modifies the vector (like insertion, removal or sorting) is called after rotations.
+///
+/// ### Example
+/// ```
+/// RingList<int> window = {1, 2, 3, 4, 5};
+/// window <<= 2; // O(1), nothing is moved
+/// window[0]; // 3
+/// window += 6; // the elements are moved once: [3, 4, 5, 1, 2, 6]
+/// ```
+template <typename T, typename Allocator = void>
+using RingList = List<T, 0, Allocator, true>;
+
+namespace pmr
+{
+
+/// List which allocates from a memory resource, like an `Arena`, and passes it on to the elements which are allocator-aware.
+template <typename T>
+using List = pyincpp::List<T, 0, std::pmr::polymorphic_allocator<T>>;
+
+} // namespace pmr
+
 } // namespace pyincpp
 
 #endif // LIST_HPP
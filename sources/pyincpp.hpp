@@ -8,14 +8,21 @@
 #define PYINCPP_HPP
 
 #if ((defined(_MSVC_LANG) && _MSVC_LANG > 201703L) || __cplusplus > 201703L)
+#include "arena.hpp"
 #include "complex.hpp"
 #include "deque.hpp"
 #include "dict.hpp"
+#include "format.hpp"
 #include "fraction.hpp"
+#include "gap_list.hpp"
 #include "int.hpp"
+#include "lazy.hpp"
 #include "list.hpp"
+#include "rope.hpp"
 #include "set.hpp"
 #include "str.hpp"
+#include "str_builder.hpp"
+#include "str_view.hpp"
 #include "tuple.hpp"
 
 #else
@@ -0,0 +1,540 @@
+//! @file rope.hpp
+//! @author Chen QingYu <chen_qingyu@qq.com>
+//! @brief Rope class.
+//! @date 2026.10.16
+
+#ifndef ROPE_HPP
+#define ROPE_HPP
+
+#include "detail.hpp"
+
+#include "list.hpp"
+#include "str.hpp"
+
+namespace pyincpp
+{
+
+/// Rope is immutable sequence of characters for large texts, stored as a balanced tree of chunks.
+/// Concatenation, slicing, insertion and erasure are O(log N) and share the chunks instead of copying them.
+/// Searching and splitting walk the chunks in place, only `data()` flattens them into one.
+///
+/// ### Example
+/// ```
+/// Rope doc = Rope("hello") + Rope(" ") + Rope("world"); // "hello world"
+/// doc.slice(6, 11); // "world"
+/// doc.insert(5, ",").erase(0, 1); // "ello, world"
+/// doc.to_str(); // Str("hello world")
+/// ```
+class Rope
+{
+private:
+    // Node of the tree, immutable once created so that it can be shared between ropes.
+    // A leaf refers to the chars [`offset`, `offset + size`) of a shared buffer, an internal node has two children.
+    struct Node
+    {
+        std::shared_ptr<const Node> left;
+        std::shared_ptr<const Node> right;
+        std::shared_ptr<const std::string> buffer;
+        int offset = 0;
+        int size = 0;
+        int height = 0;
+    };
+
+    using NodePtr = std::shared_ptr<const Node>;
+
+    // Leaves shorter than this are copied into one leaf when concatenated, to keep small appends compact.
+    static constexpr int SHORT_LEAF = 256;
+
+    // Root of the tree, nullptr for an empty rope.
+    // Mutable because `data()` replaces the tree with a single leaf of the same content.
+    mutable NodePtr root_;
+
+    // Create a rope from the root.
+    explicit Rope(NodePtr root)
+        : root_(std::move(root))
+    {
+    }
+
+    // Return the height of the node, -1 for nullptr.
+    static int height(const NodePtr& node)
+    {
+        return node ? node->height : -1;
+    }
+
+    // Create a leaf of chars [`offset`, `offset + size`) of the buffer.
+    static NodePtr make_leaf(std::shared_ptr<const std::string> buffer, int offset, int size)
+    {
+        return std::make_shared<const Node>(Node{nullptr, nullptr, std::move(buffer), offset, size, 0});
+    }
+
+    // Create an internal node of two non-null children.
+    static NodePtr make_node(NodePtr left, NodePtr right)
+    {
+        const int size = left->size + right->size;
+        const int h = std::max(left->height, right->height) + 1;
+        return std::make_shared<const Node>(Node{std::move(left), std::move(right), nullptr, 0, size, h});
+    }
+
+    // Create an internal node of two children whose heights differ by at most 2, and rotate it to be balanced (AVL).
+    static NodePtr make_balanced(NodePtr left, NodePtr right)
+    {
+        if (height(left) > height(right) + 1)
+        {
+            if (height(left->left) >= height(left->right)) // single rotation
+            {
+                return make_node(left->left, make_node(left->right, std::move(right)));
+            }
+            return make_node(make_node(left->left, left->right->left), make_node(left->right->right, std::move(right))); // double rotation
+        }
+        if (height(right) > height(left) + 1)
+        {
+            if (height(right->right) >= height(right->left)) // single rotation
+            {
+                return make_node(make_node(std::move(left), right->left), right->right);
+            }
+            return make_node(make_node(std::move(left), right->left->left), make_node(right->left->right, right->right)); // double rotation
+        }
+        return make_node(std::move(left), std::move(right));
+    }
+
+    // Concatenate two trees, O(|height(left) - height(right)|).
+    static NodePtr join(const NodePtr& left, const NodePtr& right)
+    {
+        if (!left || !right)
+        {
+            return left ? left : right;
+        }
+
+        if (!left->left && !right->left && left->size + right->size <= SHORT_LEAF) // two short leaves
+        {
+            auto buffer = std::make_shared<std::string>();
+            buffer->reserve(left->size + right->size);
+            buffer->append(left->buffer->data() + left->offset, left->size);
+            buffer->append(right->buffer->data() + right->offset, right->size);
+            return make_leaf(std::move(buffer), 0, left->size + right->size);
+        }
+
+        if (left->height > right->height + 1)
+        {
+            return make_balanced(left->left, join(left->right, right));
+        }
+        if (right->height > left->height + 1)
+        {
+            return make_balanced(join(left, right->left), right->right);
+        }
+        return make_node(left, right);
+    }
+
+    // Split the tree into the first `index` chars and the rest, O(log N).
+    static std::pair<NodePtr, NodePtr> split(const NodePtr& node, int index)
+    {
+        if (!node || index == 0)
+        {
+            return {nullptr, node};
+        }
+        if (index == node->size)
+        {
+            return {node, nullptr};
+        }
+
+        if (!node->left) // split the leaf without copying the chars
+        {
+            return {make_leaf(node->buffer, node->offset, index), make_leaf(node->buffer, node->offset + index, node->size - index)};
+        }
+
+        if (index <= node->left->size)
+        {
+            auto [a, b] = split(node->left, index);
+            return {a, join(b, node->right)};
+        }
+        auto [a, b] = split(node->right, index - node->left->size);
+        return {join(node->left, a), b};
+    }
+
+    // Call `f` with the parts of the chunks of the tree in the range [`start`, `stop`) in order, until it returns `true`.
+    // Return `true` if it is stopped by `f`. The subtrees out of the range are skipped, so it takes O(log N) time to reach the start.
+    template <typename F>
+    static bool visit(const NodePtr& node, int start, int stop, F& f)
+    {
+        if (!node || start >= stop)
+        {
+            return false;
+        }
+        if (!node->left)
+        {
+            return f(std::string_view(node->buffer->data() + node->offset + start, stop - start));
+        }
+
+        const int mid = node->left->size;
+        if (start < mid && visit(node->left, start, std::min(stop, mid), f))
+        {
+            return true;
+        }
+        return stop > mid && visit(node->right, std::max(start, mid) - mid, stop - mid, f);
+    }
+
+    // Copy the chars in the range [`start`, `stop`) into a string.
+    std::string copy(int start, int stop) const
+    {
+        std::string buffer;
+        buffer.reserve(std::max(stop - start, 0));
+        auto append = [&](std::string_view chunk)
+        {
+            buffer.append(chunk);
+            return false;
+        };
+        visit(root_, start, stop, append);
+
+        return buffer;
+    }
+
+public:
+    /*
+     * Constructor
+     */
+
+    /// Create an empty rope.
+    Rope() = default;
+
+    /// Create a rope from null-terminated characters.
+    Rope(const char* chars)
+        : Rope(std::string(chars))
+    {
+    }
+
+    /// Create a rope by taking over the buffer of std::string.
+    Rope(std::string&& string)
+    {
+        if (!string.empty())
+        {
+            const int size = string.size();
+            root_ = make_leaf(std::make_shared<const std::string>(std::move(string)), 0, size);
+        }
+    }
+
+    /// Create a rope from std::string.
+    Rope(const std::string& string)
+        : Rope(std::string(string))
+    {
+    }
+
+    /// Create a rope from a string.
+    Rope(const Str& string)
+        : Rope(std::string(string.data(), string.size()))
+    {
+    }
+
+    /*
+     * Comparison
+     */
+
+    /// Return `true` if the rope has the same contents as another rope, compared chunk by chunk without flattening.
+    bool operator==(const Rope& that) const
+    {
+        if (size() != that.size())
+        {
+            return false;
+        }
+
+        // walk the chunks of both ropes at the same time
+        const List<std::string_view> these = chunks();
+        const List<std::string_view> those = that.chunks();
+        std::size_t pos1 = 0, pos2 = 0;
+        for (int i = 0, j = 0; i < these.size();)
+        {
+            const std::size_t len = std::min(these[i].size() - pos1, those[j].size() - pos2);
+            if (std::memcmp(these[i].data() + pos1, those[j].data() + pos2, len) != 0)
+            {
+                return false;
+            }
+            if ((pos1 += len) == these[i].size())
+            {
+                ++i;
+                pos1 = 0;
+            }
+            if ((pos2 += len) == those[j].size())
+            {
+                ++j;
+                pos2 = 0;
+            }
+        }
+
+        return true;
+    }
+
+    /*
+     * Access
+     */
+
+    /// Return the char at the specified position in the rope, O(log N).
+    /// Index can be negative, like Python's string: rope[-1] gets the last char.
+    char operator[](int index) const
+    {
+        detail::check_bounds(index, -size(), size());
+
+        index = index >= 0 ? index : index + size();
+        const Node* node = root_.get();
+        while (node->left)
+        {
+            if (index < node->left->size)
+            {
+                node = node->left.get();
+            }
+            else
+            {
+                index -= node->left->size;
+                node = node->right.get();
+            }
+        }
+
+        return (*node->buffer)[node->offset + index];
+    }
+
+    /*
+     * Examination
+     */
+
+    /// Return the number of chars in the rope.
+    int size() const
+    {
+        return root_ ? root_->size : 0;
+    }
+
+    /// Return `true` if the rope contains no chars.
+    bool is_empty() const
+    {
+        return root_ == nullptr;
+    }
+
+    /// Return const pointer to the `size()` contiguous chars of the rope, it may not be null-terminated.
+    /// The chunks are flattened into one on the first call, O(N), and then it is O(1).
+    /// It is the only member which flattens the rope: like a non-const member, it must not be called concurrently
+    /// with other members on the same rope, and it invalidates the views returned by `chunks()`.
+    const char* data() const
+    {
+        if (!root_)
+        {
+            return "";
+        }
+
+        if (root_->left)
+        {
+            std::string buffer;
+            buffer.reserve(size());
+            for_each_chunk([&](std::string_view chunk)
+                           { buffer.append(chunk); });
+            root_ = make_leaf(std::make_shared<const std::string>(std::move(buffer)), 0, size());
+        }
+
+        return root_->buffer->data() + root_->offset;
+    }
+
+    /// Return the number of chunks in the rope.
+    int chunk_count() const
+    {
+        int cnt = 0;
+        for_each_chunk([&](std::string_view)
+                       { ++cnt; });
+
+        return cnt;
+    }
+
+    /// Call `f` with each chunk (as std::string_view) of the rope in order, without flattening.
+    template <typename F>
+    void for_each_chunk(F f) const
+    {
+        auto each = [&](std::string_view chunk)
+        {
+            f(chunk);
+            return false;
+        };
+        visit(root_, 0, size(), each);
+    }
+
+    /// Return a list of the chunks (as std::string_view) of the rope in order, without flattening.
+    /// The views are valid as long as the rope is alive and not flattened by `data()`.
+    List<std::string_view> chunks() const
+    {
+        List<std::string_view> list;
+        for_each_chunk([&](std::string_view chunk)
+                       { list += chunk; });
+
+        return list;
+    }
+
+    /// Return the index of the first occurrence of the specified pattern in the specified range [`start`, `stop`).
+    /// Or -1 if the rope does not contain the pattern (in the specified range). Same as `Str::find()`.
+    /// The chunks are searched in place, with the last `pattern.size() - 1` chars of the previous chunks carried over
+    /// to find the occurrences which cross a boundary, so it takes O(log N) time to reach `start` and never flattens the rope.
+    int find(const Str& pattern, int start = 0, int stop = INT_MAX) const
+    {
+        if (start > size())
+        {
+            return -1;
+        }
+
+        stop = stop > size() ? size() : stop;
+        const std::string_view patt(pattern.data(), pattern.size());
+        if (patt.empty())
+        {
+            return start;
+        }
+
+        const std::size_t overlap = patt.size() - 1;
+        std::string carry;  // last chars before `pos`, at most `overlap`
+        std::string window; // carried chars and the first chars of the chunk
+        int pos = start;    // index of the first char of the chunk
+        int found = -1;
+        auto search = [&](std::string_view chunk)
+        {
+            // an occurrence which starts in the carried chars and ends in the chunk
+            if (!carry.empty())
+            {
+                window.assign(carry).append(chunk.substr(0, overlap));
+                if (auto i = window.find(patt); i < carry.size())
+                {
+                    found = pos - int(carry.size()) + int(i);
+                    return true;
+                }
+            }
+
+            if (auto i = chunk.find(patt); i != std::string_view::npos)
+            {
+                found = pos + int(i);
+                return true;
+            }
+
+            if (chunk.size() >= overlap)
+            {
+                carry.assign(chunk.substr(chunk.size() - overlap));
+            }
+            else
+            {
+                carry.append(chunk);
+                carry.erase(0, carry.size() - std::min(carry.size(), overlap));
+            }
+            pos += chunk.size();
+            return false;
+        };
+        visit(root_, start, stop, search);
+
+        return found;
+    }
+
+    /// Return `true` if the rope contains the specified pattern (in the specified range [`start`, `stop`)).
+    bool contains(const Str& pattern, int start = 0, int stop = INT_MAX) const
+    {
+        return find(pattern, start, stop) != -1;
+    }
+
+    /*
+     * Production
+     */
+
+    /// Return a string with the same contents, copied from the chunks.
+    Str to_str() const
+    {
+        return copy(0, size());
+    }
+
+    /// Return a new rope which is the concatenation of the rope and another rope, O(log N).
+    Rope operator+(const Rope& that) const
+    {
+        return Rope(join(root_, that.root_));
+    }
+
+    /// Return slice of the rope from `start` to `stop`, O(log N).
+    /// Index can be negative, like `Str::slice()` with step 1.
+    Rope slice(int start, int stop) const
+    {
+        detail::check_bounds(start, -size(), size() + 1);
+        detail::check_bounds(stop, -size() - 1, size() + 1);
+
+        // convert
+        start = start < 0 ? start + size() : start;
+        stop = stop < 0 ? stop + size() : stop;
+
+        if (start >= stop)
+        {
+            return Rope();
+        }
+
+        return Rope(split(split(root_, stop).first, start).second);
+    }
+
+    /// Return a new rope with the chars from `start` to `stop` erased, O(log N).
+    /// Index can be negative, like `slice()`.
+    Rope erase(int start, int stop) const
+    {
+        detail::check_bounds(start, -size(), size() + 1);
+        detail::check_bounds(stop, -size() - 1, size() + 1);
+
+        // convert
+        start = start < 0 ? start + size() : start;
+        stop = stop < 0 ? stop + size() : stop;
+
+        if (start >= stop)
+        {
+            return *this;
+        }
+
+        auto [left, rest] = split(root_, start);
+        return Rope(join(left, split(rest, stop - start).second));
+    }
+
+    /// Return a new rope with the specified `rope` inserted at the specified `index`, O(log N).
+    /// Index can be negative, like `List::insert()`.
+    Rope insert(int index, const Rope& rope) const
+    {
+        detail::check_bounds(index, -size(), size() + 1);
+
+        auto [left, right] = split(root_, index >= 0 ? index : index + size());
+        return Rope(join(join(left, rope.root_), right));
+    }
+
+    /// Return a list of the strings in the rope, using `sep` as the separator string. Same as `Str::split()`.
+    /// The strings are copied from the chunks, without flattening the rope.
+    List<Str> split(const Str& sep = " ", bool keep_empty = false) const
+    {
+        if (sep.is_empty())
+        {
+            throw std::runtime_error("Error: Empty separator.");
+        }
+
+        List<Str> str_list;
+        int this_start = 0;
+        for (int patt_start = 0; (patt_start = find(sep, this_start)) != -1; this_start = patt_start + sep.size())
+        {
+            if (!keep_empty && patt_start == this_start) // skip empty str
+            {
+                continue;
+            }
+            str_list += copy(this_start, patt_start);
+        }
+        if (keep_empty || this_start != size())
+        {
+            str_list += copy(this_start, size());
+        }
+
+        return str_list;
+    }
+
+    /*
+     * Print
+     */
+
+    /// Output the rope to the specified output stream.
+    friend std::ostream& operator<<(std::ostream& os, const Rope& rope)
+    {
+        os << "\"";
+        rope.for_each_chunk([&](std::string_view chunk)
+                            { os << chunk; });
+        os << "\"";
+
+        return os;
+    }
+};
+
+} // namespace pyincpp
+
+#endif // ROPE_HPP
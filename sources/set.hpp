@@ -14,37 +14,61 @@ namespace pyincpp
 {
 
 /// Set is collection of distinct objects.
-template <typename T>
+/// The memory is allocated by `Allocator` (std::allocator if void), see `pmr::Set` for sets in an `Arena`.
+template <typename T, typename Allocator = void>
 class Set
 {
 private:
     // Set.
-    std::set<T> set_;
+    // The comparator is transparent for heterogeneous lookup, see `detail::transparent_key`.
+    std::set<T, std::less<>, detail::allocator_of<T, Allocator>> set_;
 
 public:
     /*
      * Constructor
      */
 
+    /// Type of the allocator.
+    /// The containers with a polymorphic allocator pass their memory resource on to the `pmr::Set` elements.
+    using allocator_type = detail::allocator_of<T, Allocator>;
+
     /// Create an empty set.
     Set() = default;
 
+    /// Create an empty set which allocates by the `allocator`, like `pmr::Set<int>(&arena)`.
+    explicit Set(const allocator_type& allocator)
+        : set_(allocator)
+    {
+    }
+
     /// Create a set with the contents of the initializer list `init`.
-    Set(const std::initializer_list<T>& init)
-        : set_(init)
+    Set(const std::initializer_list<T>& init, const allocator_type& allocator = allocator_type())
+        : set_(init, allocator)
     {
     }
 
     /// Create a set with the contents of the range [`first`, `last`).
     template <std::input_iterator InputIt>
-    Set(const InputIt& first, const InputIt& last)
-        : set_(first, last)
+    Set(const InputIt& first, const InputIt& last, const allocator_type& allocator = allocator_type())
+        : set_(first, last, allocator)
     {
     }
 
     /// Create a set from std::set.
-    Set(const std::set<T>& set)
-        : set_(set)
+    Set(const std::set<T>& set, const allocator_type& allocator = allocator_type())
+        : set_(set.begin(), set.end(), allocator)
+    {
+    }
+
+    /// Create a copy of the set which allocates by the `allocator`.
+    Set(const Set& that, const allocator_type& allocator)
+        : set_(that.set_, allocator)
+    {
+    }
+
+    /// Move the set into one which allocates by the `allocator`, the elements are moved one by one if the allocators differ.
+    Set(Set&& that, const allocator_type& allocator)
+        : set_(std::move(that.set_), allocator)
     {
     }
 
@@ -123,6 +147,12 @@ public:
         return set_.empty();
     }
 
+    /// Return the allocator of the set.
+    allocator_type get_allocator() const
+    {
+        return set_.get_allocator();
+    }
+
     /// Return the iterator of the specified element in the set, or end() if the set does not contain the element.
     auto find(const T& element) const
     {
@@ -135,6 +165,21 @@ public:
         return find(element) != end();
     }
 
+    /// Return the iterator of the specified element in the set, or end() if the set does not contain the element,
+    /// without constructing a T from the `element`.
+    template <detail::transparent_key<T> Key>
+    auto find(const Key& element) const
+    {
+        return set_.find(element);
+    }
+
+    /// Return `true` if the set contains the specified element, without constructing a T from the `element`.
+    template <detail::transparent_key<T> Key>
+    bool contains(const Key& element) const
+    {
+        return find(element) != end();
+    }
+
     /// Get the smallest item of the set.
     T min() const
     {
@@ -226,7 +271,7 @@ public:
     /// Return a new set with elements common to the set and another set.
     Set operator&(const Set& that) const
     {
-        Set new_set;
+        Set new_set(set_.get_allocator());
         std::set_intersection(set_.cbegin(), set_.cend(), that.set_.cbegin(), that.set_.cend(), std::inserter(new_set.set_, new_set.set_.begin()));
         return new_set;
     }
@@ -235,7 +280,7 @@ public:
     /// Return a new set with elements from the set and another set.
     Set operator|(const Set& that) const
     {
-        Set new_set;
+        Set new_set(set_.get_allocator());
         std::set_union(set_.cbegin(), set_.cend(), that.set_.cbegin(), that.set_.cend(), std::inserter(new_set.set_, new_set.set_.begin()));
         return new_set;
     }
@@ -244,7 +289,7 @@ public:
     /// Return a new set with elements in the set that are not in another set.
     Set operator-(const Set& that) const
     {
-        Set new_set;
+        Set new_set(set_.get_allocator());
         std::set_difference(set_.cbegin(), set_.cend(), that.set_.cbegin(), that.set_.cend(), std::inserter(new_set.set_, new_set.set_.begin()));
         return new_set;
     }
@@ -253,7 +298,7 @@ public:
     /// Return a new set with elements in either the set or another set but not both.
     Set operator^(const Set& that) const
     {
-        Set new_set;
+        Set new_set(set_.get_allocator());
         std::set_symmetric_difference(set_.cbegin(), set_.cend(), that.set_.cbegin(), that.set_.cend(), std::inserter(new_set.set_, new_set.set_.begin()));
         return new_set;
     }
@@ -269,6 +314,15 @@ public:
     }
 };
 
+namespace pmr
+{
+
+/// Set which allocates from a memory resource, like an `Arena`, and passes it on to the elements which are allocator-aware.
+template <typename T>
+using Set = pyincpp::Set<T, std::pmr::polymorphic_allocator<T>>;
+
+} // namespace pmr
+
 } // namespace pyincpp
 
 #endif // SET_HPP
@@ -14,6 +14,22 @@
 namespace pyincpp
 {
 
+class InternedStr;
+
+class Str;
+
+namespace pmr
+{
+class Str;
+} // namespace pmr
+
+// Str is ordered by its chars, so List<Str> can be sorted by radix sort.
+template <>
+inline constexpr bool detail::is_byte_string<Str> = true;
+
+template <>
+inline constexpr bool detail::is_byte_string<pmr::Str> = true;
+
 /// Str is immutable sequence of characters.
 class Str
 {
@@ -21,19 +37,23 @@ private:
     // String.
     const std::string str_;
 
+    // Hash value cached on first use, 0 means not computed yet.
+    mutable std::atomic<std::size_t> hash_ = 0;
+
+    // Test whether the character is a blank character: ' ', '\n', '\t', '\r'.
+    static bool is_blank(char ch)
+    {
+        return ch == ' ' || ch == '\n' || ch == '\t' || ch == '\r';
+    }
+
     // Used for FSM.
     enum state
     {
-        S_START = 1 << 0,    // start with blank character
-        S_SIGN = 1 << 1,     // positive or negative sign
-        S_INT = 1 << 2,      // integer part
-        S_POINT = 1 << 3,    // decimal point that doesn't have left digit
-        S_DEC = 1 << 4,      // decimal part
-        S_EXP = 1 << 5,      // scientific notation identifier
-        S_EXP_SIGN = 1 << 6, // positive or negative sign of exponent part
-        S_EXP_NUM = 1 << 7,  // exponent part number
-        S_END = 1 << 8,      // end with blank character
-        S_OTHER = 1 << 9,    // other
+        S_START = 1 << 0, // start with blank character
+        S_SIGN = 1 << 1,  // positive or negative sign
+        S_INT = 1 << 2,   // integer part
+        S_END = 1 << 3,   // end with blank character
+        S_OTHER = 1 << 4, // other
     };
 
     // Used for FSM.
@@ -42,50 +62,356 @@ private:
         E_BLANK = 1 << 10, // blank character: ' ', '\n', '\t', '\r'
         E_SIGN = 1 << 11,  // positive or negative sign: '+', '-'
         E_DIGIT = 1 << 12, // 36-based digit: '[0-9a-zA-Z]'
-        E_POINT = 1 << 13, // decimal point: '.'
-        E_EXP = 1 << 14,   // scientific notation identifier: 'e', 'E'
-        E_OTHER = 1 << 15, // other
+        E_OTHER = 1 << 13, // other
     };
 
+    // Character class of every char, used for FSM.
+    // 0-35 is the value of 36-based digit '[0-9a-zA-Z]', the others are the classes below.
+    enum char_class : unsigned char
+    {
+        C_BLANK = 36, // ' ', '\n', '\t', '\r'
+        C_SIGN = 37,  // '+', '-'
+        C_OTHER = 38, // other
+    };
+
+    // Lookup table of character classes, indexed by unsigned char.
+    static constexpr auto char_classes = []()
+    {
+        std::array<unsigned char, 256> table{};
+        table.fill(C_OTHER);
+        for (int i = 0; i < 10; ++i)
+        {
+            table['0' + i] = i;
+        }
+        for (int i = 0; i < 26; ++i)
+        {
+            table['A' + i] = table['a' + i] = 10 + i;
+        }
+        table[' '] = table['\n'] = table['\t'] = table['\r'] = C_BLANK;
+        table['+'] = table['-'] = C_SIGN;
+        return table;
+    }();
+
     // Try to transform a character to an event.
     static event get_event(const char ch, const int base)
     {
-        if (ch == ' ' || ch == '\n' || ch == '\t' || ch == '\r')
+        static constexpr event events[3] = {E_BLANK, E_SIGN, E_OTHER};
+
+        const int cls = char_classes[static_cast<unsigned char>(ch)];
+        return cls < base ? E_DIGIT : (cls < C_BLANK ? E_OTHER : events[cls - C_BLANK]);
+    }
+
+    // Try to transform a character to an integer based on 2-36 base.
+    static int char_to_integer(char digit, int base) // 2 <= base <= 36
+    {
+        const int cls = char_classes[static_cast<unsigned char>(digit)];
+        return cls < base ? cls : -1; // -1 means not an integer
+    }
+
+    // Try to match infinity or nan (without sign) at the beginning of [`first`, `last`).
+    // Return the pointer past the match, or nullptr if not matched.
+    static const char* match_inf_nan(const char* first, const char* last, double& value)
+    {
+        static const char* words[9] = {"infinity", "INFINITY", "Infinity", "inf", "INF", "Inf", "nan", "NaN", "NAN"};
+
+        for (int i = 0; i < 9; ++i)
+        {
+            const std::size_t len = std::strlen(words[i]);
+            if (std::size_t(last - first) >= len && std::memcmp(first, words[i], len) == 0)
+            {
+                value = i < 6 ? INFINITY : NAN;
+                return first + len;
+            }
+        }
+
+        return nullptr;
+    }
+
+    // Try to parse a decimal number at the beginning of [`first`, `last`).
+    // Syntax: `[+-](digits[.digits*] | .digits)[(e|E)[+-]digits]`, or `[+-]` infinity or nan.
+    // Return the pointer past the number, or nullptr if there is no valid number.
+    //
+    // The significant digits are accumulated into a 64-bit integer, 8 digits at a time when possible.
+    // If the value is exactly representable in this way (Clinger's fast path), it is computed directly,
+    // otherwise falls back to the correctly rounded `std::from_chars` (Eisel-Lemire in libstdc++ and libc++).
+    static const char* parse_decimal(const char* first, const char* last, double& value)
+    {
+        // exact powers of ten representable by double
+        static constexpr double pow10[23] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+        constexpr int MAX_DIGITS = 19; // 10^19 - 1 < 2^64
+
+        const char* p = first;
+        const bool negative = p != last && *p == '-';
+        p += p != last && (*p == '+' || *p == '-');
+
+        if (p != last && (*p == 'i' || *p == 'I' || *p == 'n' || *p == 'N'))
+        {
+            const char* end = match_inf_nan(p, last, value);
+            value = end != nullptr && negative && !std::isnan(value) ? -value : value;
+            return end;
+        }
+
+        const char* number = p;   // the unsigned part, for fallback
+        std::uint64_t mantissa = 0; // first MAX_DIGITS digits (including leading zeros)
+        int digits = 0;           // number of digits in mantissa
+        int exp10 = 0;            // value ~= mantissa * 10^exp10
+        bool truncated = false;   // whether there are more digits than MAX_DIGITS
+
+        // integer part
+        const char* int_first = p;
+        while (digits + 8 <= MAX_DIGITS && last - p >= 8 && detail::is_eight_digits(p))
+        {
+            mantissa = mantissa * 100'000'000 + detail::parse_eight_digits(p);
+            digits += 8;
+            p += 8;
+        }
+        for (unsigned d; p != last && (d = unsigned(*p - '0')) < 10; ++p)
+        {
+            if (digits < MAX_DIGITS)
+            {
+                mantissa = mantissa * 10 + d;
+                digits += mantissa != 0; // skip leading zeros
+            }
+            else
+            {
+                exp10++;
+                truncated |= d != 0;
+            }
+        }
+        bool has_digits = p != int_first;
+
+        // decimal part
+        if (p != last && *p == '.')
+        {
+            const char* dec_first = ++p;
+            while (digits + 8 <= MAX_DIGITS && last - p >= 8 && detail::is_eight_digits(p))
+            {
+                mantissa = mantissa * 100'000'000 + detail::parse_eight_digits(p);
+                digits += 8;
+                exp10 -= 8;
+                p += 8;
+            }
+            for (unsigned d; p != last && (d = unsigned(*p - '0')) < 10; ++p)
+            {
+                if (digits < MAX_DIGITS)
+                {
+                    mantissa = mantissa * 10 + d;
+                    digits += mantissa != 0; // skip leading zeros
+                    exp10--;
+                }
+                else
+                {
+                    truncated |= d != 0;
+                }
+            }
+            has_digits |= p != dec_first;
+        }
+
+        if (!has_digits)
+        {
+            return nullptr;
+        }
+
+        // exponent part
+        if (p != last && (*p == 'e' || *p == 'E'))
+        {
+            ++p;
+            const bool exp_negative = p != last && *p == '-';
+            p += p != last && (*p == '+' || *p == '-');
+
+            const char* exp_first = p;
+            int exp = 0;
+            for (unsigned d; p != last && (d = unsigned(*p - '0')) < 10; ++p)
+            {
+                exp = exp < 100'000 ? exp * 10 + d : exp; // saturate, far beyond the range of double
+            }
+            if (p == exp_first)
+            {
+                return nullptr;
+            }
+            exp10 += exp_negative ? -exp : exp;
+        }
+
+        if (mantissa == 0)
+        {
+            value = 0;
+        }
+        else if (!truncated && mantissa <= (1ull << 53) && exp10 >= -22 && exp10 <= 22) // Clinger's fast path
+        {
+            value = exp10 < 0 ? double(mantissa) / pow10[-exp10] : double(mantissa) * pow10[exp10];
+        }
+        else if (std::from_chars(number, p, value).ec == std::errc::result_out_of_range)
+        {
+            // the exponent of the leading significant digit tells overflow or underflow
+            int magnitude = exp10 - 1;
+            for (std::uint64_t m = mantissa; m != 0; m /= 10)
+            {
+                ++magnitude;
+            }
+            value = magnitude > 0 ? HUGE_VAL : 0;
+        }
+
+        value = negative ? -value : value;
+        return p;
+    }
+
+    // Convert the chars in range [`first`, `last`) to a decimal number, see `to_decimal()`.
+    static double to_decimal(const char* first, const char* last)
+    {
+        while (first != last && is_blank(*first))
+        {
+            ++first;
+        }
+        while (last != first && is_blank(last[-1]))
+        {
+            --last;
+        }
+
+        double value;
+        if (parse_decimal(first, last, value) != last || first == last)
+        {
+            throw std::runtime_error("Error: Invalid literal for to_decimal().");
+        }
+
+        return value;
+    }
+
+    // Parse the decimal numbers in range [`first`, `last`), see `parse_decimals()`.
+    static List<double> parse_decimals(const char* first, const char* last)
+    {
+        std::vector<double> numbers;
+        const char* p = first;
+
+        bool expect_number = false; // a comma must be followed by a number
+        while (true)
         {
-            return E_BLANK;
+            while (p != last && is_blank(*p))
+            {
+                ++p;
+            }
+            if (p == last)
+            {
+                if (expect_number)
+                {
+                    throw std::runtime_error("Error: Invalid literal for parse_decimals().");
+                }
+                break;
+            }
+
+            double value;
+            p = parse_decimal(p, last, value);
+            if (p == nullptr || (p != last && !is_blank(*p) && *p != ','))
+            {
+                throw std::runtime_error("Error: Invalid literal for parse_decimals().");
+            }
+            numbers.push_back(value);
+
+            while (p != last && is_blank(*p))
+            {
+                ++p;
+            }
+            expect_number = p != last && *p == ',';
+            p += expect_number;
         }
-        else if (ch == '+' || ch == '-')
+
+        return numbers;
+    }
+
+    // Parse an integer with an optional sign in the base at the beginning of [`first`, `last`), like `std::from_chars`.
+    // The `ec` is `std::errc::invalid_argument` if there is no digit, or `std::errc::result_out_of_range` if the value
+    // does not fit in long long (`ptr` is past the digits anyway).
+    static std::from_chars_result parse_int64(const char* first, const char* last, int base, long long& value)
+    {
+        const char* p = first;
+        const bool negative = p != last && *p == '-';
+        p += p != last && (*p == '+' || *p == '-');
+
+        const char* digits = p;
+        std::uint64_t magnitude = 0;
+        bool overflow = false;
+
+        // up to 16 digits by SWAR, that is less than 10^16, then the rest one by one with overflow check
+        if (base == 10)
         {
-            return E_SIGN;
+            while (p - digits <= 8 && last - p >= 8 && detail::is_eight_digits(p))
+            {
+                magnitude = magnitude * 100'000'000 + detail::parse_eight_digits(p);
+                p += 8;
+            }
         }
-        else if (char_to_integer(ch, base) != -1)
+        for (unsigned d; p != last && (d = char_classes[static_cast<unsigned char>(*p)]) < unsigned(base); ++p)
         {
-            return E_DIGIT;
+            overflow = overflow || magnitude > (UINT64_MAX - d) / base;
+            magnitude = magnitude * base + d;
         }
-        else if (ch == '.')
+
+        if (p == digits)
         {
-            return E_POINT;
+            return {first, std::errc::invalid_argument};
         }
-        else if (ch == 'e' || ch == 'E')
+        if (overflow || magnitude > std::uint64_t(LLONG_MAX) + negative)
         {
-            return E_EXP;
+            return {p, std::errc::result_out_of_range};
         }
-        return E_OTHER;
+
+        value = negative ? static_cast<long long>(0 - magnitude) : static_cast<long long>(magnitude);
+        return {p, std::errc()};
     }
 
-    // Try to transform a character to an integer based on 2-36 base.
-    static int char_to_integer(char digit, int base) // 2 <= base <= 36
+    // Parse the integers in range [`first`, `last`), see `parse_ints()`.
+    template <typename T>
+    static List<T> parse_ints(const char* first, const char* last, char sep)
     {
-        static const char* upper_digits = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ";
-        static const char* lower_digits = "0123456789abcdefghijklmnopqrstuvwxyz";
-        for (int i = 0; i < base; ++i)
+        std::vector<T> numbers;
+        const char* p = first;
+
+        bool expect_number = false; // a separator must be followed by a number
+        while (true)
         {
-            if (digit == upper_digits[i] || digit == lower_digits[i])
+            while (p != last && is_blank(*p))
+            {
+                ++p;
+            }
+            if (p == last)
+            {
+                if (expect_number)
+                {
+                    throw std::runtime_error("Error: Invalid literal for parse_ints().");
+                }
+                break;
+            }
+
+            long long value = 0;
+            const char* start = p;
+            auto [end, ec] = parse_int64(p, last, 10, value);
+            p = end;
+            if (ec == std::errc::invalid_argument || (p != last && !is_blank(*p) && *p != sep))
+            {
+                throw std::runtime_error("Error: Invalid literal for parse_ints().");
+            }
+            if constexpr (std::is_same_v<T, Int>)
+            {
+                // fall back to Int only for the values too large, LLONG_MIN is also too large for Int(long long)
+                numbers.push_back(ec == std::errc() && value != LLONG_MIN ? Int(value) : Int(std::string(start, p).c_str()));
+            }
+            else
+            {
+                if (ec == std::errc::result_out_of_range)
+                {
+                    throw std::runtime_error("Error: Integer overflow for parse_ints().");
+                }
+                numbers.push_back(value);
+            }
+
+            while (p != last && is_blank(*p))
             {
-                return i;
+                ++p;
             }
+            expect_number = p != last && *p == sep;
+            p += expect_number;
         }
-        return -1; // not an integer
+
+        return numbers;
     }
 
     // Format helper, see https://codereview.stackexchange.com/questions/269425/implementing-stdformat
@@ -122,12 +448,23 @@ public:
     {
     }
 
+    /// Create a string by taking over the buffer of std::string.
+    Str(std::string&& string)
+        : str_(std::move(string))
+    {
+    }
+
     /// Copy constructor.
-    Str(const Str& that) = default;
+    Str(const Str& that)
+        : str_(that.str_)
+        , hash_(that.hash_.load(std::memory_order_relaxed))
+    {
+    }
 
     /// Move constructor.
-    Str(Str&& that)
+    Str(Str&& that) noexcept
         : str_(std::move(const_cast<std::string&>(that.str_)))
+        , hash_(that.hash_.exchange(0, std::memory_order_relaxed))
     {
     }
 
@@ -135,8 +472,84 @@ public:
      * Comparison
      */
 
+    /// Return `true` if the string is equal to another string.
+    /// Strings of different lengths or different cached hash values are unequal without comparing the chars.
+    bool operator==(const Str& that) const
+    {
+        if (size() != that.size())
+        {
+            return false;
+        }
+
+        const std::size_t h1 = hash_.load(std::memory_order_relaxed);
+        const std::size_t h2 = that.hash_.load(std::memory_order_relaxed);
+        if (h1 != 0 && h2 != 0 && h1 != h2)
+        {
+            return false;
+        }
+
+        return std::memcmp(data(), that.data(), size()) == 0;
+    }
+
     /// Compare the string with another string.
-    auto operator<=>(const Str& that) const = default;
+    std::strong_ordering operator<=>(const Str& that) const
+    {
+        return compare(that);
+    }
+
+    /// Return `true` if the string is equal to a string-like object (such as `const char*` and `std::string_view`),
+    /// without constructing a Str.
+    template <typename S>
+        requires std::is_convertible_v<const S&, std::string_view>
+    bool operator==(const S& that) const
+    {
+        return std::string_view(str_) == std::string_view(that);
+    }
+
+    /// Compare the string with a string-like object (such as `const char*` and `std::string_view`),
+    /// without constructing a Str.
+    template <typename S>
+        requires std::is_convertible_v<const S&, std::string_view>
+    std::strong_ordering operator<=>(const S& that) const
+    {
+        return std::string_view(str_) <=> std::string_view(that);
+    }
+
+    /// Return the length of the longest common prefix of the string and another string.
+    int common_prefix(const Str& that) const
+    {
+        const int n = std::min(size(), that.size());
+        int i = 0;
+        for (; i + 8 <= n; i += 8) // compare a word at a time
+        {
+            const std::uint64_t diff = detail::load_word(data() + i) ^ detail::load_word(that.data() + i);
+            if (diff != 0)
+            {
+                return i + detail::first_byte(diff);
+            }
+        }
+        while (i < n && str_[i] == that.str_[i])
+        {
+            ++i;
+        }
+
+        return i;
+    }
+
+    /// Compare the string with another string, the first `prefix` chars of them are known to be equal and skipped.
+    /// Useful for searching in sorted strings where the common prefix with the bounds is tracked (like a binary search).
+    /// The `prefix` must not be greater than `common_prefix(that)`.
+    std::strong_ordering compare(const Str& that, int prefix = 0) const
+    {
+        const std::size_t n = std::min(size(), that.size()) - prefix;
+        const int cmp = std::memcmp(data() + prefix, that.data() + prefix, n);
+        if (cmp != 0)
+        {
+            return cmp < 0 ? std::strong_ordering::less : std::strong_ordering::greater;
+        }
+
+        return size() <=> that.size();
+    }
 
     /*
      * Assignment
@@ -146,13 +559,15 @@ public:
     Str& operator=(const Str& that)
     {
         const_cast<std::string&>(str_) = that.str_;
+        hash_.store(that.hash_.load(std::memory_order_relaxed), std::memory_order_relaxed);
         return *this;
     }
 
     /// Move assignment operator.
-    Str& operator=(Str&& that)
+    Str& operator=(Str&& that) noexcept
     {
         const_cast<std::string&>(str_) = std::move(const_cast<std::string&>(that.str_));
+        hash_.store(that.hash_.exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
         return *this;
     }
 
@@ -275,116 +690,20 @@ public:
     /// ```
     double to_decimal() const
     {
-        // check infinity or nan
-        static const char* pos_infs[12] = {"inf", "INF", "Inf", "+inf", "+INF", "+Inf", "infinity", "INFINITY", "Infinity", "+infinity", "+INFINITY", "+Infinity"};
-        static const char* neg_infs[6] = {"-inf", "-INF", "-Inf", "-infinity", "-INFINITY", "-Infinity"};
-        static const char* nans[9] = {"nan", "NaN", "NAN", "+nan", "+NaN", "+NAN", "-nan", "-NaN", "-NAN"};
-
-        for (int i = 0; i < 12; ++i)
-        {
-            if (str_ == pos_infs[i])
-            {
-                return INFINITY;
-            }
-        }
-        for (int i = 0; i < 6; ++i)
-        {
-            if (str_ == neg_infs[i])
-            {
-                return -INFINITY;
-            }
-        }
-        for (int i = 0; i < 9; ++i)
-        {
-            if (str_ == nans[i])
-            {
-                return NAN;
-            }
-        }
-
-        // not infinity or nan
-
-        double sign = 1; // default '+'
-        double decimal_part = 0;
-        int decimal_cnt = 0;
-        double exp_sign = 1; // default '+'
-        int exp_part = 0;
-
-        // FSM
-        state st = S_START;
-        for (int i = 0; i < size(); ++i)
-        {
-            event ev = get_event(str_[i], 10);
-            switch (int(st) | int(ev))
-            {
-                case int(S_START) | int(E_BLANK):
-                    st = S_START;
-                    break;
-
-                case int(S_START) | int(E_SIGN):
-                    sign = (str_[i] == '+') ? 1 : -1;
-                    st = S_SIGN;
-                    break;
-
-                case int(S_START) | int(E_POINT):
-                case int(S_SIGN) | int(E_POINT):
-                    st = S_POINT;
-                    break;
-
-                case int(S_START) | int(E_DIGIT):
-                case int(S_SIGN) | int(E_DIGIT):
-                case int(S_INT) | int(E_DIGIT):
-                    decimal_part = decimal_part * 10 + char_to_integer(str_[i], 10);
-                    st = S_INT;
-                    break;
-
-                case int(S_INT) | int(E_POINT):
-                    st = S_DEC;
-                    break;
-
-                case int(S_POINT) | int(E_DIGIT):
-                case int(S_DEC) | int(E_DIGIT):
-                    decimal_part = decimal_part * 10 + char_to_integer(str_[i], 10);
-                    decimal_cnt++;
-                    st = S_DEC;
-                    break;
-
-                case int(S_INT) | int(E_EXP):
-                case int(S_DEC) | int(E_EXP):
-                    st = S_EXP;
-                    break;
-
-                case int(S_EXP) | int(E_SIGN):
-                    exp_sign = (str_[i] == '+') ? 1 : -1;
-                    st = S_EXP_SIGN;
-                    break;
-
-                case int(S_EXP) | int(E_DIGIT):
-                case int(S_EXP_SIGN) | int(E_DIGIT):
-                case int(S_EXP_NUM) | int(E_DIGIT):
-                    exp_part = exp_part * 10 + char_to_integer(str_[i], 10);
-                    st = S_EXP_NUM;
-                    break;
-
-                case int(S_INT) | int(E_BLANK):
-                case int(S_DEC) | int(E_BLANK):
-                case int(S_EXP_NUM) | int(E_BLANK):
-                case int(S_END) | int(E_BLANK):
-                    st = S_END;
-                    break;
-
-                default:
-                    st = S_OTHER;
-                    i = size(); // exit loop
-                    break;
-            }
-        }
-        if (st != S_INT && st != S_DEC && st != S_EXP_NUM && st != S_END)
-        {
-            throw std::runtime_error("Error: Invalid literal for to_decimal().");
-        }
+        return to_decimal(data(), data() + size());
+    }
 
-        return sign * ((decimal_part / std::pow(10, decimal_cnt)) * std::pow(10, exp_sign * exp_part));
+    /// Parse all the decimal numbers separated by blank characters or commas, such as a column of a CSV file.
+    /// Each number has the same syntax as `to_decimal()`.
+    ///
+    /// ### Example
+    /// ```
+    /// Str("1.5 2e3\n-3").parse_decimals(); // [1.5, 2000, -3]
+    /// Str("1, 2.5 , inf").parse_decimals(); // [1, 2.5, inf]
+    /// ```
+    List<double> parse_decimals() const
+    {
+        return parse_decimals(data(), data() + size());
     }
 
     /// Convert the string to an `Int` based on 2-36 `base`.
@@ -406,8 +725,13 @@ public:
             throw std::runtime_error("Error: Invalid base for to_integer().");
         }
 
-        bool non_negative = true; // default '+'
+        // digits are accumulated into a machine word `chunk` first, and then into `integer`
+        // with one multiplication and one addition, `chunk_pow` is base^(number of digits in `chunk`)
+        int max_pow = 1'000'000'000 / base; // make sure chunk_pow <= 10^9
+        bool non_negative = true;           // default '+'
         Int integer;
+        int chunk = 0;
+        int chunk_pow = 1;
 
         // FSM
         state st = S_START;
@@ -428,7 +752,14 @@ public:
                 case int(S_START) | int(E_DIGIT):
                 case int(S_SIGN) | int(E_DIGIT):
                 case int(S_INT) | int(E_DIGIT):
-                    integer = integer * base + char_to_integer(str_[i], base);
+                    if (chunk_pow > max_pow)
+                    {
+                        integer = integer * chunk_pow + chunk;
+                        chunk = 0;
+                        chunk_pow = 1;
+                    }
+                    chunk = chunk * base + char_to_integer(str_[i], base);
+                    chunk_pow *= base;
                     st = S_INT;
                     break;
 
@@ -447,15 +778,147 @@ public:
         {
             throw std::runtime_error("Error: Invalid literal for to_integer().");
         }
+        integer = integer * chunk_pow + chunk;
 
         return non_negative ? integer : -integer;
     }
 
-    /// Return `true` if the string begins with the specified string, otherwise return `false`.
-    bool starts_with(const Str& str) const
+    /// Convert the string to a 64-bit integer of the base (2-36), like `to_integer()` but without arbitrary precision.
+    /// Throw an exception if the value does not fit in long long.
+    ///
+    /// ### Example
+    /// ```
+    /// Str("-9223372036854775808").to_int64(); // LLONG_MIN
+    /// Str("7fffffffffffffff").to_int64(16); // LLONG_MAX
+    /// Str("9223372036854775808").to_int64(); // error
+    /// ```
+    long long to_int64(int base = 10) const
     {
-        return str_.starts_with(str.str_);
-    }
+        if (base < 2 || base > 36)
+        {
+            throw std::runtime_error("Error: Invalid base for to_int64().");
+        }
+
+        const char* first = str_.data();
+        const char* last = first + size();
+        while (first != last && is_blank(*first))
+        {
+            ++first;
+        }
+        while (last != first && is_blank(last[-1]))
+        {
+            --last;
+        }
+
+        long long value = 0;
+        auto [end, ec] = parse_int64(first, last, base, value);
+        if (ec == std::errc::invalid_argument || end != last)
+        {
+            throw std::runtime_error("Error: Invalid literal for to_int64().");
+        }
+        if (ec == std::errc::result_out_of_range)
+        {
+            throw std::runtime_error("Error: Integer overflow for to_int64().");
+        }
+
+        return value;
+    }
+
+    /// Parse all the decimal integers separated by blank characters or `sep`, such as a column of a CSV file.
+    /// `T` is long long (default, throw an exception if a value does not fit) or Int (values that fit in long long
+    /// are parsed fast, and the others fall back to arbitrary precision).
+    ///
+    /// ### Example
+    /// ```
+    /// Str("1 -2\n3").parse_ints(); // [1, -2, 3]
+    /// Str("1;2 ; 3").parse_ints(';'); // [1, 2, 3]
+    /// Str("1, 99999999999999999999").parse_ints<Int>(); // [1, 99999999999999999999]
+    /// ```
+    template <typename T = long long>
+        requires std::is_same_v<T, long long> || std::is_same_v<T, Int>
+    List<T> parse_ints(char sep = ',') const
+    {
+        return parse_ints<T>(data(), data() + size(), sep);
+    }
+
+    /// Return `true` if all characters in the string are ASCII.
+    bool is_ascii() const
+    {
+        return detail::ascii_count(data(), size(), 0, 0x7F) == std::size_t(size());
+    }
+
+    /// Return `true` if all characters in the string are decimal digits and there is at least one character.
+    bool is_digit() const
+    {
+        return !is_empty() && detail::ascii_count(data(), size(), '0', '9') == std::size_t(size());
+    }
+
+    /// Return `true` if all characters in the string are ASCII letters and there is at least one character.
+    bool is_alpha() const
+    {
+        return !is_empty() && detail::ascii_count(data(), size(), 'A', 'Z') + detail::ascii_count(data(), size(), 'a', 'z') == std::size_t(size());
+    }
+
+    /// Return `true` if all characters in the string are blank (' ', '\t', '\n', '\v', '\f', '\r') and there is at least one character.
+    bool is_space() const
+    {
+        return !is_empty() && detail::ascii_count(data(), size(), '\t', '\r') + detail::ascii_count(data(), size(), ' ', ' ') == std::size_t(size());
+    }
+
+    /// Return `true` if all cased characters in the string are lowercase and there is at least one cased character.
+    bool is_lower() const
+    {
+        return detail::ascii_count(data(), size(), 'A', 'Z') == 0 && detail::ascii_count(data(), size(), 'a', 'z') != 0;
+    }
+
+    /// Return `true` if all cased characters in the string are uppercase and there is at least one cased character.
+    bool is_upper() const
+    {
+        return detail::ascii_count(data(), size(), 'a', 'z') == 0 && detail::ascii_count(data(), size(), 'A', 'Z') != 0;
+    }
+
+    /// Return `true` if the string is equal to another string ignoring case, same as `lower() == that.lower()`.
+    bool casefold_equals(const Str& that) const
+    {
+        return size() == that.size() && detail::ascii_casefold_equal(data(), that.data(), size());
+    }
+
+    /// Return the hash value of the string ignoring case, same for strings that are `casefold_equals()`.
+    /// Useful for normalizing keys without creating a lowercase copy.
+    std::size_t casefold_hash() const
+    {
+        return detail::ascii_casefold_hash(data(), size());
+    }
+
+    /// Return `true` if the string is valid UTF-8 (RFC 3629).
+    bool is_valid_utf8() const
+    {
+        return detail::utf8_validate(data(), size());
+    }
+
+    /// Return the number of code points in the string, which is valid UTF-8.
+    int utf8_size() const
+    {
+        return detail::utf8_count(data(), size());
+    }
+
+    /// Return a range of the code points (as char32_t) in the string, which is decoded as UTF-8.
+    /// Each invalid byte is decoded as U+FFFD.
+    ///
+    /// ### Example
+    /// ```
+    /// for (char32_t cp : Str("h\xc3\xa9").code_points()) {} // U+0068, U+00E9
+    /// ```
+    auto code_points() const
+    {
+        return std::ranges::subrange(detail::Utf8Iterator(data(), data() + size()), detail::Utf8Iterator(data() + size(), data() + size()));
+    }
+
+    /// Return `true` if the string begins with the specified string, otherwise return `false`.
+    bool starts_with(const Str& str) const
+    {
+        return str_.starts_with(str.str_);
+    }
 
     /// Return `true` if the string ends with the specified string, otherwise return `false`.
     bool ends_with(const Str& str) const
@@ -475,12 +938,8 @@ public:
             return *this;
         }
 
-        if (n < 0)
-        {
-            return *this << -n;
-        }
-
-        return *this << size() - n;
+        // right rotation by n is left rotation by -n
+        return *this << -(n % size());
     }
 
     /// Copy and rotate the string to left `n` characters.
@@ -498,8 +957,10 @@ public:
             n += size();
         }
 
+        // one allocation and two copies: [n, size) then [0, n)
         std::string buffer(size(), 0);
-        std::rotate_copy(begin(), begin() + n, end(), buffer.begin());
+        std::memcpy(buffer.data(), str_.data() + n, size() - n);
+        std::memcpy(buffer.data() + size() - n, str_.data(), n);
 
         return buffer;
     }
@@ -513,33 +974,62 @@ public:
         return buffer;
     }
 
-    /// Return a copy of the string with all the characters converted to lowercase.
-    Str lower() const
+    /// Return the string with the code points reversed, the string is valid UTF-8.
+    Str utf8_reverse() const
     {
-        std::string buffer = str_;
-        for (char& c : buffer)
+        std::string buffer(size(), 0);
+        char* dest = buffer.data() + size();
+        for (int start = 0, stop = 1; start < size(); start = stop++)
         {
-            if (c >= 'A' && c <= 'Z')
+            while (stop < size() && (static_cast<unsigned char>(str_[stop]) & 0xC0) == 0x80) // continuation bytes
             {
-                c |= 0b0010'0000;
+                ++stop;
             }
+            dest -= stop - start;
+            std::memcpy(dest, str_.data() + start, stop - start);
         }
 
         return buffer;
     }
 
-    /// Return a copy of the string with all the characters converted to uppercase.
-    Str upper() const
+    /// Return slice of the string from code point `start` to code point `stop`, the string is valid UTF-8.
+    /// Index can be negative, like `slice()` with step 1.
+    Str utf8_slice(int start, int stop) const
     {
-        std::string buffer = str_;
-        for (char& c : buffer)
+        const int len = utf8_size();
+        detail::check_bounds(start, -len, len + 1);
+        detail::check_bounds(stop, -len - 1, len + 1);
+
+        // convert
+        start = start < 0 ? start + len : start;
+        stop = stop < 0 ? stop + len : stop;
+
+        if (start >= stop)
         {
-            if (c >= 'a' && c <= 'z')
-            {
-                c &= 0b1101'1111;
-            }
+            return Str();
         }
 
+        const std::size_t first = detail::utf8_offset(data(), size(), start);
+        const std::size_t last = first + detail::utf8_offset(data() + first, size() - first, stop - start);
+
+        return std::string(str_, first, last - first);
+    }
+
+    /// Return a copy of the string with all the characters converted to lowercase.
+    Str lower() const
+    {
+        std::string buffer(size(), 0);
+        detail::ascii_flip_case(data(), buffer.data(), size(), 'A', 'Z');
+
+        return buffer;
+    }
+
+    /// Return a copy of the string with all the characters converted to uppercase.
+    Str upper() const
+    {
+        std::string buffer(size(), 0);
+        detail::ascii_flip_case(data(), buffer.data(), size(), 'a', 'z');
+
         return buffer;
     }
 
@@ -564,44 +1054,77 @@ public:
     /// ```
     Str replace(const Str& old_str, const Str& new_str) const
     {
-        if (old_str.is_empty())
+        const int old_len = old_str.size();
+        const int new_len = new_str.size();
+
+        if (old_len == 0)
+        {
+            // insert new_str before every char and at the end
+            std::string buffer(size() + std::size_t(size() + 1) * new_len, 0);
+            char* dest = buffer.data();
+            for (int i = 0; i < size(); ++i)
+            {
+                std::memcpy(dest, new_str.data(), new_len);
+                dest += new_len;
+                *dest++ = str_[i];
+            }
+            std::memcpy(dest, new_str.data(), new_len);
+
+            return buffer;
+        }
+
+        // count first, so that the result is allocated exactly once
+        const int cnt = count(old_str);
+        if (cnt == 0)
         {
-            std::ostringstream ss;
-            std::copy(str_.begin(), str_.end(), std::ostream_iterator<char>(ss, new_str.data()));
-            return new_str.str_ + ss.str();
+            return *this;
         }
 
-        std::string buffer;
+        std::string buffer(size() + std::ptrdiff_t(cnt) * (new_len - old_len), 0);
+        char* dest = buffer.data();
 
         int this_start = 0;
-        for (int patt_start = 0; (patt_start = find(old_str, this_start)) != -1; this_start = patt_start + old_str.size())
+        for (int patt_start = 0; (patt_start = find(old_str, this_start)) != -1; this_start = patt_start + old_len)
         {
-            buffer += str_.substr(this_start, patt_start - this_start) + new_str.str_;
+            std::memcpy(dest, str_.data() + this_start, patt_start - this_start);
+            dest += patt_start - this_start;
+            std::memcpy(dest, new_str.data(), new_len);
+            dest += new_len;
         }
+        std::memcpy(dest, str_.data() + this_start, size() - this_start);
 
-        return buffer += str_.substr(this_start);
+        return buffer;
     }
 
     /// Remove leading and trailing characters (default is blank character) of the string.
     Str strip(const signed char& ch = -1) const
     {
-        std::string buffer = str_;
+        const unsigned char lo = ch == -1 ? 0 : ch;
+        const unsigned char hi = ch == -1 ? 0x20 : ch;
+        const std::size_t start = detail::ascii_span(data(), size(), lo, hi);
+        const std::size_t stop = start + detail::ascii_rspan(data() + start, size() - start, lo, hi);
 
-        int i = 0;
-        while (i < int(buffer.size()) && (ch == -1 ? buffer[i] <= 0x20 : buffer[i] == ch))
-        {
-            ++i;
-        }
-        buffer.erase(buffer.begin(), buffer.begin() + i);
+        return std::string(str_, start, stop - start);
+    }
 
-        i = buffer.size() - 1;
-        while (i >= 0 && (ch == -1 ? buffer[i] <= 0x20 : buffer[i] == ch))
-        {
-            --i;
-        }
-        buffer.erase(buffer.begin() + i + 1, buffer.end());
+    /// Remove leading characters (default is blank character) of the string.
+    Str lstrip(const signed char& ch = -1) const
+    {
+        const unsigned char lo = ch == -1 ? 0 : ch;
+        const unsigned char hi = ch == -1 ? 0x20 : ch;
+        const std::size_t start = detail::ascii_span(data(), size(), lo, hi);
 
-        return buffer;
+        return std::string(str_, start);
+    }
+
+    /// Remove trailing characters (default is blank character) of the string.
+    Str rstrip(const signed char& ch = -1) const
+    {
+        const unsigned char lo = ch == -1 ? 0 : ch;
+        const unsigned char hi = ch == -1 ? 0x20 : ch;
+        const std::size_t stop = detail::ascii_rspan(data(), size(), lo, hi);
+
+        return std::string(str_, 0, stop);
     }
 
     /// Return slice of the string from `start` to `stop` with certain `step`.
@@ -621,10 +1144,28 @@ public:
         stop = stop < 0 ? stop + size() : stop;
 
         // copy
-        std::string buffer;
-        for (int i = start; (step > 0) ? (i < stop) : (i > stop); i += step)
+        if (step == 1)
+        {
+            return start < stop ? std::string(str_, start, stop - start) : std::string();
+        }
+
+        const int len = step > 0 ? (stop - start + step - 1) / step : (start - stop - step - 1) / -step;
+        if (len <= 0)
+        {
+            return Str();
+        }
+
+        std::string buffer(len, 0);
+        if (step == -1)
         {
-            buffer += str_[i];
+            std::reverse_copy(str_.begin() + stop + 1, str_.begin() + start + 1, buffer.begin());
+        }
+        else
+        {
+            for (int i = 0, j = start; i < len; ++i, j += step)
+            {
+                buffer[i] = str_[j];
+            }
         }
 
         return buffer;
@@ -650,10 +1191,18 @@ public:
             throw std::runtime_error("Error: Require times >= 0 for repeat.");
         }
 
-        std::string buffer(size() * times, 0);
-        for (int part = 0; part < times; part++)
+        const std::size_t total = std::size_t(size()) * times;
+        std::string buffer(total, 0);
+        if (total == 0)
+        {
+            return buffer;
+        }
+
+        // copy once, and then double the copied part until it is full
+        std::memcpy(buffer.data(), str_.data(), size());
+        for (std::size_t done = size(); done < total; done *= 2)
         {
-            std::copy(begin(), end(), buffer.begin() + size() * part);
+            std::memcpy(buffer.data() + done, buffer.data(), std::min(done, total - done));
         }
 
         return buffer;
@@ -707,11 +1256,26 @@ public:
             return Str();
         }
 
-        std::string buffer = str_list[0].str_;
-        for (int i = 1; i < str_list.size(); ++i)
+        // sum up the lengths first, so that the result is allocated exactly once
+        std::size_t len = std::size_t(size()) * (str_list.size() - 1);
+        for (const auto& str : str_list)
         {
-            buffer += str_ + str_list[i].str_;
+            len += str.size();
         }
+
+        std::string buffer(len, 0);
+        char* dest = buffer.data();
+
+        std::memcpy(dest, str_list[0].data(), str_list[0].size());
+        dest += str_list[0].size();
+        for (auto it = str_list.begin() + 1; it != str_list.end(); ++it)
+        {
+            std::memcpy(dest, str_.data(), size());
+            dest += size();
+            std::memcpy(dest, it->data(), it->size());
+            dest += it->size();
+        }
+
         return buffer;
     }
 
@@ -726,6 +1290,44 @@ public:
         return oss.str();
     }
 
+    /// Return the handle of the string in the global interning pool, adding the string to the pool if it is not there.
+    /// Handles of equal strings share one copy of the chars, and compare equal in O(1).
+    InternedStr intern() const;
+
+    /*
+     * Static
+     */
+
+    /// Read the whole file at the specified `path` into a string, with one read into a presized buffer.
+    /// Files larger than INT_MAX bytes are rejected, since the size of a string is int, see `StrView::map_file()` for them.
+    static Str read_file(const Str& path)
+    {
+        std::ifstream file(path.data(), std::ios::binary | std::ios::ate);
+        if (!file)
+        {
+            throw std::runtime_error("Error: Cannot open the file.");
+        }
+
+        const std::streamoff size = file.tellg();
+        if (size == -1) // the size is unknown
+        {
+            throw std::runtime_error("Error: Cannot read the file.");
+        }
+        if (size > INT_MAX)
+        {
+            throw std::runtime_error("Error: The file is too large.");
+        }
+
+        std::string buffer(size, '\0');
+        file.seekg(0);
+        if (!file.read(buffer.data(), buffer.size()))
+        {
+            throw std::runtime_error("Error: Cannot read the file.");
+        }
+
+        return buffer;
+    }
+
     /*
      * Print / Input
      */
@@ -744,10 +1346,13 @@ public:
     /// Get a line of string from the specified input stream.
     friend std::istream& operator>>(std::istream& is, Str& string)
     {
+        string.hash_.store(0, std::memory_order_relaxed);
         return std::getline(is, const_cast<std::string&>(string.str_));
     }
 
     friend struct std::hash<pyincpp::Str>;
+
+    friend class StrView;
 };
 
 } // namespace pyincpp
@@ -757,7 +1362,418 @@ struct std::hash<pyincpp::Str> // explicit specialization
 {
     std::size_t operator()(const pyincpp::Str& string) const
     {
-        return std::hash<std::string>{}(string.str_);
+        // the string is immutable, so the hash value is computed only once
+        std::size_t value = string.hash_.load(std::memory_order_relaxed);
+        if (value == 0)
+        {
+            value = pyincpp::detail::hash_bytes(string.str_.data(), string.str_.size());
+            value += (value == 0); // 0 is reserved for "not computed yet"
+            string.hash_.store(value, std::memory_order_relaxed);
+        }
+
+        return value;
+    }
+};
+
+namespace pyincpp
+{
+
+namespace detail
+{
+
+// Entry of the interning pool.
+struct InternEntry
+{
+    Str str;
+    std::size_t hash;
+};
+
+// Global pool of interned strings, entries are never removed so that handles stay valid.
+class InternPool
+{
+private:
+    // Hash function of the keys.
+    struct Hash
+    {
+        std::size_t operator()(std::string_view key) const
+        {
+            return hash_bytes(key.data(), key.size());
+        }
+    };
+
+    // Entries keyed by views of their own strings.
+    std::unordered_map<std::string_view, std::unique_ptr<InternEntry>, Hash> entries_;
+
+    // Lookups share the lock, insertions own it.
+    std::shared_mutex mutex_;
+
+public:
+    // Return the only pool.
+    // It is never destroyed, so that the handles in other static objects stay valid during static destruction.
+    static InternPool& instance()
+    {
+        static InternPool& pool = *new InternPool;
+        return pool;
+    }
+
+    // Return the entry of the string, add it if not found. Thread-safe.
+    const InternEntry* intern(const Str& string)
+    {
+        const std::string_view key(string.data(), string.size());
+
+        {
+            std::shared_lock lock(mutex_);
+            if (auto it = entries_.find(key); it != entries_.end())
+            {
+                return it->second.get();
+            }
+        }
+
+        std::unique_lock lock(mutex_);
+        if (auto it = entries_.find(key); it != entries_.end()) // inserted by another thread meanwhile
+        {
+            return it->second.get();
+        }
+        auto entry = std::make_unique<InternEntry>(InternEntry{string, std::hash<Str>{}(string)});
+        const InternEntry* result = entry.get();
+        entries_.emplace(std::string_view(result->str.data(), result->str.size()), std::move(entry));
+        return result;
+    }
+
+    // Return the number of entries. Thread-safe.
+    int size()
+    {
+        std::shared_lock lock(mutex_);
+        return entries_.size();
+    }
+};
+
+} // namespace detail
+
+/// InternedStr is handle of a string in the global interning pool, see `Str::intern()`.
+/// It is as small as a pointer, equal strings share one entry so equality is a pointer comparison,
+/// and the hash value is computed once when the string is added to the pool.
+///
+/// ### Example
+/// ```
+/// InternedStr key = Str("content-type").intern();
+/// key == Str("content-type").intern(); // true, O(1)
+/// key.str(); // "content-type"
+/// Dict<InternedStr, int>{{key, 1}}; // repeated keys share one copy of the chars
+/// ```
+class InternedStr
+{
+private:
+    // Entry in the pool.
+    const detail::InternEntry* entry_;
+
+public:
+    /*
+     * Constructor
+     */
+
+    /// Create a handle of the empty string.
+    InternedStr()
+        : InternedStr(Str())
+    {
+    }
+
+    /// Create a handle of the specified string, adding the string to the pool if it is not there.
+    explicit InternedStr(const Str& string)
+        : entry_(detail::InternPool::instance().intern(string))
+    {
+    }
+
+    /*
+     * Comparison
+     */
+
+    /// Return `true` if the handles refer to the same string, O(1).
+    bool operator==(const InternedStr& that) const
+    {
+        return entry_ == that.entry_;
+    }
+
+    /// Compare the strings of the handles lexicographically, same order as Str.
+    auto operator<=>(const InternedStr& that) const
+    {
+        return entry_ == that.entry_ ? std::strong_ordering::equal : entry_->str <=> that.entry_->str;
+    }
+
+    /*
+     * Examination
+     */
+
+    /// Return the string.
+    const Str& str() const
+    {
+        return entry_->str;
+    }
+
+    /// Return the precomputed hash value of the string, same as `std::hash<Str>`.
+    std::size_t hash() const
+    {
+        return entry_->hash;
+    }
+
+    /// Return the number of chars in the string.
+    int size() const
+    {
+        return entry_->str.size();
+    }
+
+    /// Return const pointer to the chars of the string, they live as long as the program.
+    const char* data() const
+    {
+        return entry_->str.data();
+    }
+
+    /// Return the number of strings in the global interning pool.
+    static int pool_size()
+    {
+        return detail::InternPool::instance().size();
+    }
+
+    /*
+     * Print
+     */
+
+    /// Output the string to the specified output stream.
+    friend std::ostream& operator<<(std::ostream& os, const InternedStr& string)
+    {
+        return os << string.str();
+    }
+};
+
+inline InternedStr Str::intern() const
+{
+    return InternedStr(*this);
+}
+
+namespace pmr
+{
+
+/// pmr::Str is immutable sequence of characters whose buffer comes from a `std::pmr::memory_resource`.
+/// The pmr containers construct their elements with their own resource, so the keys of a
+/// `pmr::Dict<pmr::Str, V>` live in the same arena as the dict. It has the same order and hash value as Str,
+/// and converts to `std::string_view` and to Str (copying the chars) for the rest of the Str methods.
+///
+/// ### Example
+/// ```
+/// Arena arena;
+/// pmr::Dict<pmr::Str, pmr::List<Int>> dict(&arena);
+/// dict.add("a key longer than the small string buffer", {1, 2, 3}); // key, list and ints all in the arena
+/// dict["a key longer than the small string buffer"]; // lookup without constructing a key
+/// ```
+class Str
+{
+private:
+    // String.
+    std::pmr::string str_;
+
+public:
+    /// The allocator type, the pmr containers pass their allocator to the string.
+    using allocator_type = std::pmr::polymorphic_allocator<char>;
+
+    /*
+     * Constructor
+     */
+
+    /// Create an empty string.
+    Str() = default;
+
+    /// Create an empty string using the specified allocator.
+    explicit Str(const allocator_type& allocator)
+        : str_(allocator)
+    {
+    }
+
+    /// Create a string from null-terminated characters.
+    Str(const char* chars, const allocator_type& allocator = {})
+        : str_(chars, allocator)
+    {
+    }
+
+    /// Create a string from a string-like object.
+    Str(std::string_view string, const allocator_type& allocator = {})
+        : str_(string, allocator)
+    {
+    }
+
+    /// Create a string from Str.
+    Str(const pyincpp::Str& string, const allocator_type& allocator = {})
+        : str_(string.data(), string.size(), allocator)
+    {
+    }
+
+    /// Copy constructor, the copy uses the default resource like `std::pmr::string`.
+    Str(const Str& that) = default;
+
+    /// Move constructor.
+    Str(Str&& that) noexcept = default;
+
+    /// Copy constructor using the specified allocator.
+    Str(const Str& that, const allocator_type& allocator)
+        : str_(that.str_, allocator)
+    {
+    }
+
+    /// Move constructor using the specified allocator, the chars are copied if the resources are not equal.
+    Str(Str&& that, const allocator_type& allocator)
+        : str_(std::move(that.str_), allocator)
+    {
+    }
+
+    /*
+     * Comparison
+     */
+
+    /// Return `true` if the string is equal to another string.
+    bool operator==(const Str& that) const
+    {
+        return str_ == that.str_;
+    }
+
+    /// Compare the string with another string, same order as Str.
+    std::strong_ordering operator<=>(const Str& that) const
+    {
+        return std::string_view(str_) <=> std::string_view(that.str_);
+    }
+
+    /// Return `true` if the string is equal to a string-like object (such as `const char*` and `std::string_view`),
+    /// without constructing a string.
+    template <typename S>
+        requires std::is_convertible_v<const S&, std::string_view>
+    bool operator==(const S& that) const
+    {
+        return std::string_view(str_) == std::string_view(that);
+    }
+
+    /// Compare the string with a string-like object (such as `const char*` and `std::string_view`),
+    /// without constructing a string.
+    template <typename S>
+        requires std::is_convertible_v<const S&, std::string_view>
+    std::strong_ordering operator<=>(const S& that) const
+    {
+        return std::string_view(str_) <=> std::string_view(that);
+    }
+
+    /*
+     * Assignment
+     */
+
+    /// Copy assignment operator, the string keeps its own allocator.
+    Str& operator=(const Str& that) = default;
+
+    /// Move assignment operator, the string keeps its own allocator.
+    Str& operator=(Str&& that) = default;
+
+    /*
+     * Iterator
+     */
+
+    /// Return an iterator to the first char of the string.
+    auto begin() const
+    {
+        return str_.cbegin();
+    }
+
+    /// Return an iterator to the char following the last char of the string.
+    auto end() const
+    {
+        return str_.cend();
+    }
+
+    /*
+     * Access
+     */
+
+    /// Return the const reference to element at the specified position in the string.
+    /// Index can be negative, like Python's string: string[-1] gets the last element.
+    const char& operator[](int index) const
+    {
+        detail::check_bounds(index, -size(), size());
+
+        return str_[index >= 0 ? index : index + size()];
+    }
+
+    /*
+     * Examination
+     */
+
+    /// Return the number of elements in the string.
+    int size() const
+    {
+        return str_.size(); // no '\0'
+    }
+
+    /// Return true if the string contains no elements.
+    bool is_empty() const
+    {
+        return str_.empty();
+    }
+
+    /// Return const pointer to contents. This is a pointer to internal data.
+    const char* data() const
+    {
+        return str_.data();
+    }
+
+    /// Return the allocator of the string.
+    allocator_type get_allocator() const
+    {
+        return str_.get_allocator();
+    }
+
+    /*
+     * Manipulation
+     */
+
+    /// Return a view of the chars of the string.
+    operator std::string_view() const
+    {
+        return str_;
+    }
+
+    /// Return a Str copy of the string, to use the methods that pmr::Str does not have.
+    pyincpp::Str to_str() const
+    {
+        return pyincpp::Str(std::string(str_));
+    }
+
+    /*
+     * Print
+     */
+
+    /// Output the string to the specified output stream.
+    friend std::ostream& operator<<(std::ostream& os, const Str& string)
+    {
+        return os << "\"" << std::string_view(string.str_) << "\"";
+    }
+};
+
+} // namespace pmr
+
+} // namespace pyincpp
+
+template <>
+struct std::hash<pyincpp::InternedStr> // explicit specialization
+{
+    std::size_t operator()(const pyincpp::InternedStr& string) const
+    {
+        return string.hash();
+    }
+};
+
+template <>
+struct std::hash<pyincpp::pmr::Str> // explicit specialization
+{
+    std::size_t operator()(const pyincpp::pmr::Str& string) const
+    {
+        // same value as std::hash<Str>
+        std::size_t value = pyincpp::detail::hash_bytes(string.data(), string.size());
+        value += (value == 0);
+        return value;
     }
 };
 
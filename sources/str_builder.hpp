@@ -0,0 +1,378 @@
+//! @file str_builder.hpp
+//! @author Chen QingYu <chen_qingyu@qq.com>
+//! @brief StrBuilder class.
+//! @date 2026.10.16
+
+#ifndef STR_BUILDER_HPP
+#define STR_BUILDER_HPP
+
+#include "detail.hpp"
+
+#include "complex.hpp"
+#include "deque.hpp"
+#include "dict.hpp"
+#include "fraction.hpp"
+#include "gap_list.hpp"
+#include "int.hpp"
+#include "list.hpp"
+#include "set.hpp"
+#include "str.hpp"
+#include "tuple.hpp"
+
+#include <charconv> // std::to_chars
+
+namespace pyincpp
+{
+
+/// StrBuilder is mutable buffer for building a Str piece by piece in amortized O(1) per char.
+///
+/// ### Example
+/// ```
+/// StrBuilder sb;
+/// sb.append("x = ").append(Int("123456789123456789")).append(", y = ").append(List<int>{1, 2, 3});
+/// sb.build(); // "x = 123456789123456789, y = [1, 2, 3]"
+/// ```
+class StrBuilder
+{
+private:
+    // Buffer.
+    std::string buffer_;
+
+    // Make sure there is room for `n` more chars, the capacity grows geometrically.
+    void grow(std::size_t n)
+    {
+        if (buffer_.size() + n > buffer_.capacity())
+        {
+            buffer_.reserve(std::max(buffer_.size() + n, buffer_.capacity() * 2));
+        }
+    }
+
+    // Append an element of a container, in the same form as `operator<<` prints it.
+    template <typename T>
+    void append_element(const T& element)
+    {
+        if constexpr (std::is_same_v<T, Str>)
+        {
+            append('"').append(element).append('"');
+        }
+        else if constexpr (requires { append(element); })
+        {
+            append(element);
+        }
+        else // fallback for types that are only printable
+        {
+            std::ostringstream oss;
+            oss << element;
+            append(oss.str().data(), oss.str().size());
+        }
+    }
+
+    // Append a key-value pair of a dictionary.
+    template <typename K, typename V>
+    void append_element(const std::pair<const K, V>& pair)
+    {
+        append_element(pair.first);
+        append(": ", 2);
+        append_element(pair.second);
+    }
+
+    // Append helper for range [`first`, `last`), see `detail::print`.
+    template <std::input_iterator InputIt>
+    StrBuilder& append_range(const InputIt& first, const InputIt& last, char open, char close)
+    {
+        if (first == last)
+        {
+            return append(open).append(close);
+        }
+
+        append(open);
+        auto it = first;
+        while (true)
+        {
+            append_element(*it++);
+            if (it == last)
+            {
+                return append(close);
+            }
+            append(", ", 2);
+        }
+    }
+
+    // Append helper for tuple.
+    template <typename... Ts>
+    void append_tuple(const Tuple<Ts...>& tuple)
+    {
+        if constexpr (sizeof...(Ts) > 0)
+        {
+            append_element(tuple.template get<0>());
+            if (tuple.size() > 1)
+            {
+                append(", ", 2);
+            }
+            append_tuple(tuple.rest());
+        }
+    }
+
+public:
+    /*
+     * Constructor
+     */
+
+    /// Create an empty builder.
+    StrBuilder() = default;
+
+    /// Create an empty builder with room for `capacity` chars.
+    explicit StrBuilder(int capacity)
+    {
+        reserve(capacity);
+    }
+
+    /*
+     * Examination
+     */
+
+    /// Return the number of chars in the builder.
+    int size() const
+    {
+        return buffer_.size();
+    }
+
+    /// Return `true` if the builder contains no chars.
+    bool is_empty() const
+    {
+        return buffer_.empty();
+    }
+
+    /// Return the number of chars that the builder can hold without reallocation.
+    int capacity() const
+    {
+        return buffer_.capacity();
+    }
+
+    /*
+     * Manipulation
+     */
+
+    /// Make sure the builder can hold at least `capacity` chars without reallocation.
+    StrBuilder& reserve(int capacity)
+    {
+        if (capacity < 0)
+        {
+            throw std::runtime_error("Error: Require capacity >= 0 for reserve(capacity).");
+        }
+
+        buffer_.reserve(capacity);
+
+        return *this;
+    }
+
+    /// Append the specified `string`.
+    StrBuilder& append(const Str& string)
+    {
+        return append(string.data(), string.size());
+    }
+
+    /// Append the chars in the range [`chars`, `chars + len`).
+    StrBuilder& append(const char* chars, int len)
+    {
+        grow(len);
+        buffer_.append(chars, len);
+
+        return *this;
+    }
+
+    /// Append the specified null-terminated `chars`.
+    StrBuilder& append(const char* chars)
+    {
+        return append(chars, std::strlen(chars));
+    }
+
+    /// Append the specified `ch`.
+    StrBuilder& append(char ch)
+    {
+        grow(1);
+        buffer_.push_back(ch);
+
+        return *this;
+    }
+
+    /// Append the specified boolean `b`, in the same form as `operator<<` prints it (`1` or `0`).
+    /// It is a template so that pointers and other types are not converted to bool.
+    template <std::same_as<bool> T>
+    StrBuilder& append(T b)
+    {
+        return append(b ? '1' : '0');
+    }
+
+    /// Append the specified primitive integer `n`.
+    template <std::integral T>
+        requires(!std::same_as<T, bool>)
+    StrBuilder& append(T n)
+    {
+        char chars[24];
+        auto [end, _] = std::to_chars(chars, chars + sizeof(chars), n);
+
+        return append(chars, end - chars);
+    }
+
+    /// Append the specified floating-point `number`, in the same form as `operator<<` prints it.
+    StrBuilder& append(double number)
+    {
+        char chars[32];
+        auto [end, _] = std::to_chars(chars, chars + sizeof(chars), number, std::chars_format::general, 6);
+
+        return append(chars, end - chars);
+    }
+
+    /// Append the specified floating-point `number` with the specified `format` and `precision`.
+    StrBuilder& append(double number, std::chars_format format, int precision)
+    {
+        char chars[384]; // enough for DBL_MAX in fixed format with some precision
+        auto [end, ec] = std::to_chars(chars, chars + sizeof(chars), number, format, precision);
+        if (ec != std::errc())
+        {
+            throw std::runtime_error("Error: Precision is too large.");
+        }
+
+        return append(chars, end - chars);
+    }
+
+    /// Append the specified `integer`.
+    StrBuilder& append(const Int& integer)
+    {
+        if (integer.sign_ == 0)
+        {
+            return append('0');
+        }
+
+        // write directly into the buffer: sign, most significant chunk, and then zero padded chunks
+        const std::size_t old_size = buffer_.size();
+        const std::size_t max_len = 1 + integer.chunks_.size() * Int::DIGITS_PER_CHUNK;
+        grow(max_len);
+        buffer_.resize(old_size + max_len);
+
+        char* dest = buffer_.data() + old_size;
+        if (integer.sign_ == -1)
+        {
+            *dest++ = '-';
+        }
+        dest = std::to_chars(dest, dest + Int::DIGITS_PER_CHUNK, integer.chunks_.back()).ptr;
+        for (auto it = integer.chunks_.rbegin() + 1; it != integer.chunks_.rend(); ++it)
+        {
+            int chunk = *it;
+            for (int i = Int::DIGITS_PER_CHUNK - 1; i >= 0; --i)
+            {
+                dest[i] = '0' + chunk % 10;
+                chunk /= 10;
+            }
+            dest += Int::DIGITS_PER_CHUNK;
+        }
+
+        buffer_.resize(dest - buffer_.data());
+
+        return *this;
+    }
+
+    /// Append the specified `fraction`.
+    StrBuilder& append(const Fraction& fraction)
+    {
+        append(fraction.numerator());
+
+        return fraction.denominator() == 1 ? *this : append('/').append(fraction.denominator());
+    }
+
+    /// Append the specified `complex`.
+    StrBuilder& append(const Complex& complex)
+    {
+        return append('(').append(complex.real()).append(complex.imag() < 0 ? '-' : '+').append(std::abs(complex.imag())).append("j)", 2);
+    }
+
+    /// Append the specified `list`.
+    template <typename T, std::size_t N, typename A, bool R>
+    StrBuilder& append(const List<T, N, A, R>& list)
+    {
+        return append_range(list.begin(), list.end(), '[', ']');
+    }
+
+    /// Append the specified `list`.
+    template <typename T>
+    StrBuilder& append(const GapList<T>& list)
+    {
+        return append_range(list.begin(), list.end(), '[', ']');
+    }
+
+    /// Append the specified `set`.
+    template <typename T, typename A>
+    StrBuilder& append(const Set<T, A>& set)
+    {
+        return append_range(set.begin(), set.end(), '{', '}');
+    }
+
+    /// Append the specified `dict`.
+    template <typename K, typename V, typename A>
+    StrBuilder& append(const Dict<K, V, A>& dict)
+    {
+        return append_range(dict.begin(), dict.end(), '{', '}');
+    }
+
+    /// Append the specified `deque`.
+    template <typename T, typename A, bool R>
+    StrBuilder& append(const Deque<T, A, R>& deque)
+    {
+        return append_range(deque.begin(), deque.end(), '<', '>');
+    }
+
+    /// Append the specified `tuple`.
+    template <typename... Ts>
+    StrBuilder& append(const Tuple<Ts...>& tuple)
+    {
+        append('(');
+        append_tuple(tuple);
+
+        return sizeof...(Ts) == 1 ? append(",)", 2) : append(')');
+    }
+
+    /// Pad the chars appended since position `start` with `fill` to at least `width` chars.
+    /// The `align` is one of '<' (pad on the right), '>' (pad on the left) and '^' (pad on both sides).
+    StrBuilder& pad(int start, int width, char fill = ' ', char align = '<')
+    {
+        detail::check_bounds(start, 0, size() + 1);
+
+        const int len = size() - start;
+        if (len >= width)
+        {
+            return *this;
+        }
+
+        const int n = width - len;
+        const int left = align == '>' ? n : (align == '^' ? n / 2 : 0);
+        grow(n);
+        buffer_.insert(start, left, fill);
+        buffer_.append(n - left, fill);
+
+        return *this;
+    }
+
+    /// Remove all chars from the builder, the capacity is kept.
+    void clear()
+    {
+        buffer_.clear();
+    }
+
+    /*
+     * Production
+     */
+
+    /// Hand over the buffer to a new string without copying, and leave the builder empty.
+    Str build()
+    {
+        Str string = std::move(buffer_);
+        buffer_.clear();
+
+        return string;
+    }
+};
+
+} // namespace pyincpp
+
+#endif // STR_BUILDER_HPP
@@ -0,0 +1,370 @@
+//! @file str_view.hpp
+//! @author Chen QingYu <chen_qingyu@qq.com>
+//! @brief StrView class.
+//! @date 2026.10.16
+
+#ifndef STR_VIEW_HPP
+#define STR_VIEW_HPP
+
+#include "detail.hpp"
+
+#include "list.hpp"
+#include "str.hpp"
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h> // CreateFileMapping MapViewOfFile
+#else
+#include <fcntl.h>    // open
+#include <sys/mman.h> // mmap munmap madvise
+#include <sys/stat.h> // fstat
+#include <unistd.h>   // close
+#endif
+
+namespace pyincpp
+{
+
+/// StrView is read-only view of a sequence of characters, which does not copy them.
+/// A view of a Str must not outlive the Str, a view created by `map_file()` keeps the mapping alive by itself.
+/// The sizes and indices are std::ptrdiff_t, so a view may be larger than a Str, like a mapped file of several GB.
+///
+/// ### Example
+/// ```
+/// StrView file = StrView::map_file("data.csv"); // no copy, pages are loaded on demand
+/// file.count("\n"); // number of lines
+/// file.split("\n")[0].split(",")[1].to_decimal(); // second field of the first line
+/// ```
+class StrView
+{
+private:
+    // View.
+    std::string_view view_;
+
+    // Owner of the mapped memory, or nullptr if the view does not own its chars.
+    std::shared_ptr<const void> owner_;
+
+    // Create a view which shares the owner.
+    StrView(std::string_view view, std::shared_ptr<const void> owner)
+        : view_(view)
+        , owner_(std::move(owner))
+    {
+    }
+
+public:
+    /*
+     * Constructor
+     */
+
+    /// Create an empty view.
+    StrView() = default;
+
+    /// Create a view of the null-terminated characters.
+    StrView(const char* chars)
+        : view_(chars)
+    {
+    }
+
+    /// Create a view of the characters in range [`chars`, `chars + len`).
+    StrView(const char* chars, std::size_t len)
+        : view_(chars, len)
+    {
+    }
+
+    /// Create a view of the string.
+    StrView(const Str& string)
+        : view_(string.data(), string.size())
+    {
+    }
+
+    /// Create a view of the pmr string.
+    StrView(const pmr::Str& string)
+        : view_(string.data(), string.size())
+    {
+    }
+
+    /*
+     * Comparison
+     */
+
+    /// Return `true` if the view has the same chars as another view.
+    bool operator==(const StrView& that) const
+    {
+        return view_ == that.view_;
+    }
+
+    /// Compare the view with another view lexicographically.
+    auto operator<=>(const StrView& that) const
+    {
+        return view_ <=> that.view_;
+    }
+
+    /*
+     * Iterator
+     */
+
+    /// Return an iterator to the first char of the view.
+    auto begin() const
+    {
+        return view_.cbegin();
+    }
+
+    /// Return an iterator to the char following the last char of the view.
+    auto end() const
+    {
+        return view_.cend();
+    }
+
+    /*
+     * Access
+     */
+
+    /// Return the const reference to char at the specified position in the view.
+    /// Index can be negative, like Python's string: view[-1] gets the last char.
+    const char& operator[](std::ptrdiff_t index) const
+    {
+        detail::check_bounds(index, -size(), size());
+
+        return view_[index >= 0 ? index : index + size()];
+    }
+
+    /*
+     * Examination
+     */
+
+    /// Return the number of chars in the view.
+    std::ptrdiff_t size() const
+    {
+        return view_.size();
+    }
+
+    /// Return `true` if the view contains no chars.
+    bool is_empty() const
+    {
+        return view_.empty();
+    }
+
+    /// Return const pointer to the chars, it may not be null-terminated.
+    const char* data() const
+    {
+        return view_.data();
+    }
+
+    /// Return the index of the first occurrence of the specified pattern in the specified range [`start`, `stop`).
+    /// Or -1 if the view does not contain the pattern (in the specified range). Same as `Str::find()`.
+    std::ptrdiff_t find(const StrView& pattern, std::ptrdiff_t start = 0, std::ptrdiff_t stop = PTRDIFF_MAX) const
+    {
+        if (start > size())
+        {
+            return -1;
+        }
+
+        stop = stop > size() ? size() : stop;
+        auto pos = view_.substr(start, stop - start).find(pattern.view_);
+
+        return pos == std::string_view::npos ? -1 : start + std::ptrdiff_t(pos);
+    }
+
+    /// Return `true` if the view contains the specified pattern (in the specified range [`start`, `stop`)).
+    bool contains(const StrView& pattern, std::ptrdiff_t start = 0, std::ptrdiff_t stop = PTRDIFF_MAX) const
+    {
+        return find(pattern, start, stop) != -1;
+    }
+
+    /// Count the total number of occurrences of the specified pattern in the view. Same as `Str::count()`.
+    std::ptrdiff_t count(const StrView& pattern) const
+    {
+        if (pattern.is_empty())
+        {
+            return size() + 1;
+        }
+
+        std::ptrdiff_t cnt = 0;
+        for (std::ptrdiff_t start = 0; (start = find(pattern, start)) != -1; start += pattern.size())
+        {
+            ++cnt;
+        }
+
+        return cnt;
+    }
+
+    /// Convert the view to a double-precision floating-point decimal number. Same as `Str::to_decimal()`.
+    double to_decimal() const
+    {
+        return Str::to_decimal(data(), data() + size());
+    }
+
+    /// Parse all the decimal numbers separated by blank characters or commas. Same as `Str::parse_decimals()`.
+    List<double> parse_decimals() const
+    {
+        return Str::parse_decimals(data(), data() + size());
+    }
+
+    /// Parse all the decimal integers separated by blank characters or `sep`. Same as `Str::parse_ints()`.
+    template <typename T = long long>
+        requires std::is_same_v<T, long long> || std::is_same_v<T, Int>
+    List<T> parse_ints(char sep = ',') const
+    {
+        return Str::parse_ints<T>(data(), data() + size(), sep);
+    }
+
+    /*
+     * Production
+     */
+
+    /// Return a string with a copy of the chars.
+    /// Views larger than INT_MAX chars are rejected, since the size of a string is int.
+    Str to_str() const
+    {
+        if (size() > INT_MAX)
+        {
+            throw std::runtime_error("Error: The view is too large for a string.");
+        }
+
+        return std::string(view_);
+    }
+
+    /// Return a view of the chars from `start` to `stop`, without copying.
+    /// Index can be negative, like `Str::slice()` with step 1.
+    StrView slice(std::ptrdiff_t start, std::ptrdiff_t stop) const
+    {
+        detail::check_bounds(start, -size(), size() + 1);
+        detail::check_bounds(stop, -size() - 1, size() + 1);
+
+        // convert
+        start = start < 0 ? start + size() : start;
+        stop = stop < 0 ? stop + size() : stop;
+
+        return StrView(start < stop ? view_.substr(start, stop - start) : std::string_view(), owner_);
+    }
+
+    /// Return a list of the views of the fields, using `sep` as the separator. Same as `Str::split()` but without copying.
+    List<StrView> split(const StrView& sep = " ", bool keep_empty = false) const
+    {
+        if (sep.is_empty())
+        {
+            throw std::runtime_error("Error: Empty separator.");
+        }
+
+        List<StrView> view_list;
+        std::ptrdiff_t this_start = 0;
+        for (std::ptrdiff_t patt_start = 0; (patt_start = find(sep, this_start)) != -1; this_start = patt_start + sep.size())
+        {
+            if (!keep_empty && patt_start == this_start) // skip empty view
+            {
+                continue;
+            }
+            view_list += StrView(view_.substr(this_start, patt_start - this_start), owner_);
+        }
+        if (keep_empty || this_start != size())
+        {
+            view_list += StrView(view_.substr(this_start), owner_);
+        }
+
+        return view_list;
+    }
+
+    /*
+     * Static
+     */
+
+    /// Map the file at the specified `path` into memory read-only, and return a view of its contents.
+    /// The pages are loaded on demand by the OS and shared with the page cache, so nothing is copied.
+    /// The mapping is released when the last view of it (including slices and split results) is destroyed.
+    static StrView map_file(const Str& path)
+    {
+#ifdef _WIN32
+        HANDLE file = CreateFileA(path.data(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            throw std::runtime_error("Error: Cannot open the file.");
+        }
+
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(file, &size))
+        {
+            CloseHandle(file);
+            throw std::runtime_error("Error: Cannot read the file.");
+        }
+        if (size.QuadPart == 0) // empty file can not be mapped
+        {
+            CloseHandle(file);
+            return StrView();
+        }
+        if (std::uint64_t(size.QuadPart) > SIZE_MAX) // can not be mapped in a 32-bit process
+        {
+            CloseHandle(file);
+            throw std::runtime_error("Error: The file is too large.");
+        }
+
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(file);
+        if (mapping == nullptr)
+        {
+            throw std::runtime_error("Error: Cannot map the file.");
+        }
+        const void* addr = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(mapping); // the view keeps the mapping alive
+        if (addr == nullptr)
+        {
+            throw std::runtime_error("Error: Cannot map the file.");
+        }
+
+        std::shared_ptr<const void> owner(addr, [](const void* p)
+                                          { UnmapViewOfFile(p); });
+        const std::size_t len = size.QuadPart;
+#else
+        const int fd = open(path.data(), O_RDONLY);
+        if (fd == -1)
+        {
+            throw std::runtime_error("Error: Cannot open the file.");
+        }
+
+        struct stat st;
+        if (fstat(fd, &st) == -1)
+        {
+            close(fd);
+            throw std::runtime_error("Error: Cannot read the file.");
+        }
+        if (std::uint64_t(st.st_size) > SIZE_MAX) // can not be mapped in a 32-bit process
+        {
+            close(fd);
+            throw std::runtime_error("Error: The file is too large.");
+        }
+        const std::size_t len = st.st_size;
+        if (len == 0) // empty file can not be mapped
+        {
+            close(fd);
+            return StrView();
+        }
+
+        void* addr = mmap(nullptr, len, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd); // the mapping keeps the file alive
+        if (addr == MAP_FAILED)
+        {
+            throw std::runtime_error("Error: Cannot map the file.");
+        }
+        madvise(addr, len, MADV_SEQUENTIAL);
+
+        std::shared_ptr<const void> owner(addr, [len](const void* p)
+                                          { munmap(const_cast<void*>(p), len); });
+#endif
+
+        return StrView(std::string_view(static_cast<const char*>(addr), len), std::move(owner));
+    }
+
+    /*
+     * Print
+     */
+
+    /// Output the view to the specified output stream.
+    friend std::ostream& operator<<(std::ostream& os, const StrView& view)
+    {
+        return os << "\"" << view.view_ << "\"";
+    }
+};
+
+} // namespace pyincpp
+
+#endif // STR_VIEW_HPP
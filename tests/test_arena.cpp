@@ -0,0 +1,169 @@
+#include "../sources/pyincpp.hpp"
+
+#include "tool.hpp"
+
+using namespace pyincpp;
+
+TEST_CASE("Arena")
+{
+    Arena arena(256);
+
+    SECTION("basics")
+    {
+        REQUIRE(arena.used() == 0);
+        REQUIRE(arena.capacity() == 0);
+
+        void* p = arena.allocate(100, 8);
+        void* q = arena.allocate(10, 64);
+        REQUIRE(reinterpret_cast<std::uintptr_t>(p) % 8 == 0);
+        REQUIRE(reinterpret_cast<std::uintptr_t>(q) % 64 == 0);
+        REQUIRE(arena.used() == 110);
+        REQUIRE(arena.capacity() == 256);
+
+        // larger than a block
+        REQUIRE(arena.allocate(1000) != nullptr);
+        REQUIRE(arena.used() == 1110);
+        REQUIRE(arena.capacity() > 1256);
+
+        REQUIRE(arena.is_equal(arena));
+        REQUIRE(!arena.is_equal(*std::pmr::new_delete_resource()));
+    }
+
+    SECTION("reset")
+    {
+        void* p = arena.allocate(100);
+        arena.reset();
+        REQUIRE(arena.used() == 0);
+        REQUIRE(arena.allocate(100) == p); // the memory is reused
+
+        // several blocks are merged into one
+        for (int i = 0; i < 100; ++i)
+        {
+            REQUIRE(arena.allocate(100) != nullptr);
+        }
+        const std::size_t capacity = arena.capacity();
+        arena.reset();
+        REQUIRE(arena.capacity() == capacity);
+        for (int i = 0; i < 100; ++i)
+        {
+            REQUIRE(arena.allocate(100) != nullptr);
+        }
+        REQUIRE(arena.capacity() == capacity);
+    }
+
+    SECTION("containers")
+    {
+        pmr::List<int> list({1, 2, 3}, &arena);
+        list += 4;
+        REQUIRE(list == pmr::List<int>{1, 2, 3, 4});
+        REQUIRE(list.get_allocator().resource() == &arena);
+        REQUIRE(list.slice(1, 3).get_allocator().resource() == &arena);
+        REQUIRE((list + list).get_allocator().resource() == &arena);
+
+        pmr::Set<int> set({1, 2, 3}, &arena);
+        REQUIRE((set & pmr::Set<int>{2, 3, 4}) == pmr::Set<int>{2, 3});
+        REQUIRE((set | set).get_allocator().resource() == &arena);
+
+        pmr::Deque<int> deque(&arena);
+        deque.push_back(1);
+        deque.push_front(0);
+        REQUIRE(deque == pmr::Deque<int>{0, 1});
+        REQUIRE(deque.get_allocator().resource() == &arena);
+
+        REQUIRE(arena.used() > 0);
+    }
+
+    SECTION("nested")
+    {
+        // the resource is passed on to the elements
+        pmr::Dict<pmr::Str, pmr::List<Int>> dict(&arena);
+        dict.add("primes", {2, 3, 5, 7});
+        dict["primes"] += Int("123456789012345678901234567890");
+        REQUIRE(dict["primes"].get_allocator().resource() == &arena);
+        REQUIRE(dict.begin()->first.get_allocator().resource() == &arena);
+        REQUIRE(dict["primes"][-1].get_allocator().resource() == &arena);
+        REQUIRE(dict["primes"][-1] == Int("123456789012345678901234567890"));
+
+        // a copy allocates by default
+        pmr::List<Int> copy = dict["primes"];
+        REQUIRE(copy == dict["primes"]);
+        REQUIRE(copy.get_allocator().resource() == std::pmr::get_default_resource());
+
+        // a key longer than the small string buffer is allocated in the arena too
+        const char* key = "a key longer than the small string buffer";
+        const std::size_t used = arena.used();
+        dict.add(key, {1});
+        REQUIRE(arena.used() - used > std::strlen(key));
+        REQUIRE(dict[key] == pmr::List<Int>{1});
+        REQUIRE(dict.contains(Str(key)));
+    }
+
+    SECTION("str")
+    {
+        pmr::Str::allocator_type allocator(&arena);
+        pmr::Str a("hello world, hello arena", allocator);
+        pmr::Str b(a, allocator);
+        REQUIRE(a.get_allocator().resource() == &arena);
+        REQUIRE(b.get_allocator().resource() == &arena);
+        REQUIRE(pmr::Str(a).get_allocator().resource() == std::pmr::get_default_resource());
+
+        // same order and hash value as Str
+        REQUIRE(a == b);
+        REQUIRE(a == "hello world, hello arena");
+        REQUIRE(a == Str("hello world, hello arena"));
+        REQUIRE(Str("hello world, hello arena") == a);
+        REQUIRE(a < pmr::Str("hello z"));
+        REQUIRE(a > "hello");
+        REQUIRE(std::hash<pmr::Str>()(a) == std::hash<Str>()(Str("hello world, hello arena")));
+
+        REQUIRE(a.size() == 24);
+        REQUIRE(a[0] == 'h');
+        REQUIRE(a[-1] == 'a');
+        REQUIRE_THROWS_MATCHES(a[24], std::runtime_error, Message("Error: Index out of range."));
+        REQUIRE(pmr::Str().is_empty());
+        REQUIRE(a.to_str().split(", ") == List<Str>{"hello world", "hello arena"});
+        REQUIRE(StrView(a).count("hello") == 2);
+
+        // assignment keeps the allocator
+        pmr::Str c(allocator);
+        c = pmr::Str("another string longer than the buffer");
+        REQUIRE(c == "another string longer than the buffer");
+        REQUIRE(c.get_allocator().resource() == &arena);
+
+        std::ostringstream oss;
+        oss << a;
+        REQUIRE(oss.str() == "\"hello world, hello arena\"");
+
+        pmr::List<pmr::Str> list({"b", "c", "a"}, &arena);
+        REQUIRE(list[0].get_allocator().resource() == &arena);
+        list.sort();
+        REQUIRE(list == pmr::List<pmr::Str>{"a", "b", "c"});
+    }
+
+    SECTION("int")
+    {
+        Int::allocator_type allocator(&arena);
+        Int a(std::allocator_arg, allocator, "-99999999999999999999");
+        Int b(std::allocator_arg, allocator, a);
+        REQUIRE(a.get_allocator().resource() == &arena);
+        REQUIRE(b == a);
+
+        // the default allocator allocates by `operator new`
+        REQUIRE(Int(a).get_allocator().resource() == nullptr);
+        REQUIRE(a + b == Int("-199999999999999999998"));
+
+        // in place operations keep the chunks in the arena, even when they are swapped with a copy of the operand
+        pmr::List<Int> list(&arena);
+        list += Int("1234567890123456789012345678901");
+        Int& x = list[0];
+        x -= Int("999999999999999999999999999999999999999");
+        REQUIRE(x == Int("-999999998765432109876543210987654321098"));
+        x += Int("999999999999999999999999999999999999999");
+        REQUIRE(x == Int("1234567890123456789012345678901"));
+        x *= Int("-1000000000000000000000");
+        REQUIRE(x == Int("-1234567890123456789012345678901000000000000000000000"));
+        x -= x;
+        REQUIRE(x == 0);
+        REQUIRE(x.get_allocator().resource() == &arena);
+    }
+}
@@ -155,6 +155,14 @@ TEST_CASE("Complex")
         REQUIRE_THROWS_MATCHES(Complex::pow(zero, negative), std::runtime_error, Message("Error: Math domain error."));
     }
 
+    SECTION("hash")
+    {
+        std::hash<Complex> hash;
+        REQUIRE(hash(Complex(0.0, 0.0)) == hash(Complex(-0.0, -0.0)));
+        REQUIRE(hash(Complex(1, 2)) == hash(Complex(1, 2)));
+        REQUIRE(hash(Complex(1, 2)) != hash(Complex(2, 1)));
+    }
+
     SECTION("print")
     {
         std::ostringstream oss;
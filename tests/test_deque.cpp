@@ -159,6 +159,16 @@ TEST_CASE("Deque")
             REQUIRE(empty.pop_front() == size - i);
         }
         REQUIRE(empty.size() == 0);
+
+        // move and emplace, move-only elements are never copied
+        Deque<std::unique_ptr<int>> ptrs;
+        ptrs.push_back(std::make_unique<int>(2));
+        ptrs.push_front(std::make_unique<int>(1));
+        REQUIRE(*ptrs.emplace_back(new int(3)) == 3);
+        REQUIRE(*ptrs.emplace_front(new int(0)) == 0);
+        REQUIRE(*ptrs.pop_front() == 0);
+        REQUIRE(*ptrs.pop_back() == 3);
+        REQUIRE(*ptrs.front() + *ptrs.back() == 3);
     }
 
     SECTION("extend")
@@ -224,6 +234,67 @@ TEST_CASE("Deque")
         REQUIRE((empty <<= -233) == Deque<int>{1, 2, 3, 4, 5});
     }
 
+    SECTION("rotate_lazily")
+    {
+        RingDeque<int> deque = {1, 2, 3, 4, 5};
+
+        // access by index without moving the elements
+        deque <<= 2;
+        REQUIRE(deque.front() == 3);
+        REQUIRE(deque.back() == 2);
+        REQUIRE(deque[2] == 5);
+        REQUIRE(deque[-2] == 1);
+        deque.back() = 6;
+        deque >>= 4;
+        REQUIRE(deque.front() == 4);
+        REQUIRE(deque.back() == 3);
+
+        // copy and move keep the rotation
+        RingDeque<int> copy = deque;
+        REQUIRE(copy[0] == 4);
+        RingDeque<int> moved = std::move(copy);
+        REQUIRE(moved[0] == 4);
+        REQUIRE(copy.size() == 0);
+
+        // the const members read the elements in place, without moving them
+        const int& first = deque.front();
+        const RingDeque<int>& view = deque;
+        REQUIRE(view == RingDeque<int>{4, 5, 1, 6, 3});
+        REQUIRE(view > RingDeque<int>{4, 5, 1, 2});
+        REQUIRE(std::vector<int>(view.begin(), view.end()) == std::vector<int>{4, 5, 1, 6, 3});
+        REQUIRE(std::vector<int>(view.rbegin(), view.rend()) == std::vector<int>{3, 6, 1, 5, 4});
+        std::ostringstream oss;
+        oss << view;
+        REQUIRE(oss.str() == "<4, 5, 1, 6, 3>");
+        REQUIRE(&first == &deque.front());
+
+        // push and pop after rotations, from either side
+        deque <<= 1;
+        deque.push_back(7);
+        REQUIRE(deque == RingDeque<int>{5, 1, 6, 3, 4, 7});
+        deque >>= 2;
+        REQUIRE(deque.pop_front() == 4);
+        REQUIRE(deque == RingDeque<int>{7, 5, 1, 6, 3});
+        deque <<= 4;
+        deque.push_front(0);
+        REQUIRE(deque == RingDeque<int>{0, 3, 7, 5, 1, 6});
+        deque >>= 1;
+        REQUIRE(deque.pop_back() == 1);
+        REQUIRE(deque == RingDeque<int>{6, 0, 3, 7, 5});
+
+        // push the elements of the deque itself after rotations
+        RingDeque<std::string> words = {"a", "b", "c", "d", "e"};
+        words <<= 3;
+        words.push_back(words.front());
+        REQUIRE(words == RingDeque<std::string>{"d", "e", "a", "b", "c", "d"});
+        words >>= 2;
+        words.push_front(words.back());
+        REQUIRE(words == RingDeque<std::string>{"b", "c", "d", "d", "e", "a", "b"});
+        words <<= 1;
+        words.emplace_front(words[2]);
+        REQUIRE(words == RingDeque<std::string>{"d", "c", "d", "d", "e", "a", "b", "b"});
+    }
+
     SECTION("reverse")
     {
         REQUIRE(empty.reverse() == Deque<int>{});
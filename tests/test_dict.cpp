@@ -1,4 +1,5 @@
 #include "../sources/dict.hpp"
+#include "../sources/str.hpp"
 
 #include "tool.hpp"
 
@@ -120,6 +121,19 @@ TEST_CASE("Dict")
         // const access
         const Dict<std::string, int> const_dict{{"one", 1}, {"two", 2}, {"three", 3}};
         REQUIRE(const_dict["one"] == 1);
+
+        // heterogeneous lookup
+        Dict<Str, int> str_dict{{"one", 1}, {"two", 2}, {"three", 3}};
+        REQUIRE(str_dict["one"] == 1);
+        REQUIRE(str_dict[std::string_view("two")] == 2);
+        REQUIRE(str_dict[std::string("three")] == 3);
+        REQUIRE(str_dict.get("four", 233) == 233);
+        REQUIRE(str_dict.find(std::string_view("two")) == str_dict.find(Str("two")));
+        REQUIRE(str_dict.contains("one"));
+        REQUIRE(!str_dict.contains(std::string_view("four")));
+        str_dict[std::string_view("one")] = 1111;
+        REQUIRE(str_dict[Str("one")] == 1111);
+        REQUIRE_THROWS_MATCHES(str_dict["four"], std::runtime_error, Message("Error: Key is not found in the dictionary."));
     }
 
     SECTION("examination")
@@ -0,0 +1,61 @@
+#include "../sources/format.hpp"
+
+#include "tool.hpp"
+
+using namespace pyincpp;
+
+TEST_CASE("format")
+{
+    SECTION("basics")
+    {
+        REQUIRE(format("") == "");
+        REQUIRE(format("hello") == "hello");
+        REQUIRE(format("{}, {}, {}, {}.", 1, 2, 3, 4) == "1, 2, 3, 4.");
+        REQUIRE(format("I'm {}, {} years old.", "Alice", 18) == "I'm Alice, 18 years old.");
+        REQUIRE(format("{} -> {}", List<int>{1, 2, 3}, List<Str>{"one", "two", "three"}) == "[1, 2, 3] -> [\"one\", \"two\", \"three\"]");
+        REQUIRE(format("{}", GapList<int>{1, 2, 3}) == "[1, 2, 3]");
+        REQUIRE(format("{}{}{}", Int("-123456789123456789"), Fraction(1, -2), Complex(1, 2)) == "-123456789123456789-1/2(1+2j)");
+        REQUIRE(format("{}", std::string("std")) == "std");
+        REQUIRE(format("{} {}", Str("a"), 1.5) == "a 1.5");
+    }
+
+    SECTION("escape")
+    {
+        REQUIRE(format("{{}}") == "{}");
+        REQUIRE(format("{{{}}}", 1) == "{1}");
+        REQUIRE(format("a{{b}}c{}d{{", 'x') == "a{b}cxd{");
+    }
+
+    SECTION("extra_args")
+    {
+        REQUIRE(format("{}", 1, 2, 3) == "1");
+        REQUIRE(format("no field", 1) == "no field");
+    }
+
+    SECTION("width_align_fill")
+    {
+        REQUIRE(format("[{:5}]", 42) == "[   42]");
+        REQUIRE(format("[{:5}]", "ab") == "[ab   ]");
+        REQUIRE(format("[{:<5}]", 42) == "[42   ]");
+        REQUIRE(format("[{:>5}]", "ab") == "[   ab]");
+        REQUIRE(format("[{:^6}]", "ab") == "[  ab  ]");
+        REQUIRE(format("[{:^5}]", "ab") == "[ ab  ]");
+        REQUIRE(format("[{:*^7}]", Int(42)) == "[**42***]");
+        REQUIRE(format("[{:0>4}]", 7) == "[0007]");
+        REQUIRE(format("[{:2}]", "abcd") == "[abcd]");
+        REQUIRE(format("[{:8}]", List<int>{1, 2}) == "[[1, 2]  ]");
+    }
+
+    SECTION("precision_type")
+    {
+        REQUIRE(format("{:.2f}", 3.14159) == "3.14");
+        REQUIRE(format("{:>6.2f}", 3.14159) == "  3.14");
+        REQUIRE(format("{:.3}", 3.14159) == "3.14");
+        REQUIRE(format("{:.2e}", 12345.678) == "1.23e+04");
+        REQUIRE(format("{:f}", 0.5) == "0.500000");
+        REQUIRE(format("{:.1f}", Complex(1, -2)) == "(1.0-2.0j)");
+        REQUIRE(format("{:.3}", Str("abcdef")) == "abc");
+        REQUIRE(format("{:.3}", "ab") == "ab");
+        REQUIRE(format("{:*<5.2}", "abcdef") == "ab***");
+    }
+}
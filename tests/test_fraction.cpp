@@ -238,6 +238,14 @@ TEST_CASE("Fraction")
         REQUIRE(Fraction::lcm(Fraction(-1, 2), Fraction(-3, 4)) == Fraction(3, 2));
     }
 
+    SECTION("hash")
+    {
+        std::hash<Fraction> hash;
+        REQUIRE(hash(Fraction(2, 4)) == hash(Fraction(1, 2)));
+        REQUIRE(hash(Fraction(1, 2)) != hash(Fraction(2, 1)));
+        REQUIRE(hash(Fraction(-1, 2)) != hash(Fraction(1, 2)));
+    }
+
     SECTION("print")
     {
         std::ostringstream oss;
@@ -0,0 +1,194 @@
+#include "../sources/gap_list.hpp"
+#include "../sources/list.hpp"
+#include "../sources/str.hpp"
+
+#include "tool.hpp"
+
+using namespace pyincpp;
+
+TEST_CASE("GapList")
+{
+    GapList<int> empty;
+    GapList<int> some = {1, 2, 3, 4, 5};
+
+    SECTION("basics")
+    {
+        REQUIRE(empty.size() == 0);
+        REQUIRE(empty.is_empty());
+        REQUIRE(some.size() == 5);
+        REQUIRE(!some.is_empty());
+
+        List<int> list = {1, 2, 3, 4, 5};
+        REQUIRE(GapList<int>(list.begin(), list.end()) == some);
+        REQUIRE(List<int>(some.begin(), some.end()) == list);
+    }
+
+    SECTION("compare")
+    {
+        some.insert(2, 0); // the gap is in the middle
+        REQUIRE(some == GapList<int>{1, 2, 0, 3, 4, 5});
+        REQUIRE(some != GapList<int>{1, 2, 0, 3, 4});
+        REQUIRE(some < GapList<int>{1, 2, 1});
+        REQUIRE(some > GapList<int>{1, 2, 0, 3, 4});
+        REQUIRE(empty < some);
+
+        // elements which only have `==` and `<`
+        REQUIRE((GapList<EqLtType>{1, 2, 3} == GapList<EqLtType>{1, 2, 3}));
+        REQUIRE((GapList<EqLtType>{1, 2, 3} < GapList<EqLtType>{1, 2, 3}) == (List<EqLtType>{1, 2, 3} < List<EqLtType>{1, 2, 3}));
+    }
+
+    SECTION("iterator")
+    {
+        some.remove(1); // the gap is in the middle
+        int i = 0;
+        int expected[] = {1, 3, 4, 5};
+        for (const auto& e : some)
+        {
+            REQUIRE(e == expected[i++]);
+        }
+
+        REQUIRE(some.end() - some.begin() == 4);
+        REQUIRE(some.begin()[2] == 4);
+        REQUIRE(*(some.end() - 1) == 5);
+        REQUIRE(List<int>(some.rbegin(), some.rend()) == List<int>{5, 4, 3, 1});
+    }
+
+    SECTION("access")
+    {
+        REQUIRE(some[0] == 1);
+        REQUIRE(some[-1] == 5);
+
+        some.insert(3, 0);
+        some[3] = 10;
+        some[-1] = 50;
+        REQUIRE(some == GapList<int>{1, 2, 3, 10, 4, 50});
+
+        REQUIRE_THROWS_MATCHES(some[6], std::runtime_error, Message("Error: Index out of range."));
+        REQUIRE_THROWS_MATCHES(some[-7], std::runtime_error, Message("Error: Index out of range."));
+    }
+
+    SECTION("examination")
+    {
+        some.insert(2, 3);
+        REQUIRE(some.index(3) == 2);
+        REQUIRE(some.index(3, 3) == 3);
+        REQUIRE(some.index(0) == -1);
+        REQUIRE(some.contains(5));
+        REQUIRE(!some.contains(5, 0, 5));
+        REQUIRE(some.count(3) == 2);
+    }
+
+    SECTION("insert_remove")
+    {
+        // typing and deleting around a moving cursor
+        GapList<char> text;
+        for (char c : std::string("hello world"))
+        {
+            text += c;
+        }
+        text.insert(5, ',');
+        text.emplace(-6, '!');
+        REQUIRE(text.remove(-8) == ',');
+        REQUIRE(text.remove(0) == 'h');
+        text.insert(0, 'H');
+        REQUIRE(Str(std::string(text.begin(), text.end())) == "Hello! world");
+
+        REQUIRE(some.erase(1, 3) == GapList<int>{1, 4, 5});
+        REQUIRE(some.erase(2, 2) == GapList<int>{1, 4, 5});
+        REQUIRE((some += some) == GapList<int>{1, 4, 5, 1, 4, 5});
+        some.clear();
+        REQUIRE(some == empty);
+
+        // insert an element of the list itself
+        GapList<std::string> words = {"alpha", "beta", "gamma"};
+        words.insert(0, words[2]);
+        words += words[1];
+        REQUIRE(words == GapList<std::string>{"gamma", "alpha", "beta", "gamma", "alpha"});
+
+        // move-only elements
+        GapList<std::unique_ptr<int>> ptrs;
+        for (int i = 0; i < 5; ++i)
+        {
+            ptrs.insert(i / 2, std::make_unique<int>(i));
+        }
+        REQUIRE(*ptrs[0] == 1);
+        REQUIRE(*ptrs.remove(-1) == 0);
+
+        REQUIRE_THROWS_MATCHES(empty.remove(0), std::runtime_error, Message("Error: The container is empty."));
+        REQUIRE_THROWS_MATCHES(some.insert(1, 0), std::runtime_error, Message("Error: Index out of range."));
+    }
+
+    SECTION("rotate_reverse")
+    {
+        some.insert(2, 0);
+        REQUIRE((some >>= 2) == GapList<int>{4, 5, 1, 2, 0, 3});
+        REQUIRE((some <<= 2) == GapList<int>{1, 2, 0, 3, 4, 5});
+        REQUIRE((some <<= -7) == GapList<int>{5, 1, 2, 0, 3, 4});
+        REQUIRE(some.reverse() == GapList<int>{4, 3, 0, 2, 1, 5});
+        some.insert(1, 9);
+        REQUIRE(some.reverse() == GapList<int>{5, 1, 2, 0, 3, 9, 4});
+    }
+
+    SECTION("slice")
+    {
+        some.insert(3, 0); // [1, 2, 3, 0, 4, 5]
+        REQUIRE(some.slice(0, 6) == GapList<int>{1, 2, 3, 0, 4, 5});
+        REQUIRE(some.slice(1, -1) == GapList<int>{2, 3, 0, 4});
+        REQUIRE(some.slice(-1, -7, -2) == GapList<int>{5, 0, 2});
+        REQUIRE(some.slice(4, 2) == empty);
+
+        REQUIRE_THROWS_MATCHES(some.slice(0, 1, 0), std::runtime_error, Message("Error: Require step != 0 for slice(start, stop, step)."));
+    }
+
+    SECTION("random")
+    {
+        // random edits, checked against List
+        std::mt19937 gen(233);
+        List<int> expected;
+        GapList<int> gap;
+        for (int i = 0; i < 2000; ++i)
+        {
+            const int op = std::uniform_int_distribution<int>(0, 5)(gen);
+            const int pos = std::uniform_int_distribution<int>(0, expected.size())(gen);
+            if (op <= 1 || expected.is_empty()) // insert
+            {
+                expected.insert(pos, i);
+                gap.insert(pos, i);
+            }
+            else if (op == 2) // remove
+            {
+                REQUIRE(gap.remove(pos % gap.size()) == expected.remove(pos % expected.size()));
+            }
+            else if (op == 3) // rotate
+            {
+                expected >>= pos;
+                gap >>= pos;
+            }
+            else if (op == 4) // reverse
+            {
+                expected.reverse();
+                gap.reverse();
+            }
+            else if (expected.size() > 16) // erase all but a few elements
+            {
+                expected.erase(4, expected.size());
+                gap.erase(4, gap.size());
+            }
+            REQUIRE(List<int>(gap.begin(), gap.end()) == expected);
+        }
+    }
+
+    SECTION("print")
+    {
+        std::ostringstream oss;
+
+        oss << empty;
+        REQUIRE(oss.str() == "[]");
+        oss.str("");
+
+        some.insert(2, 0);
+        oss << some;
+        REQUIRE(oss.str() == "[1, 2, 0, 3, 4, 5]");
+        oss.str("");
+    }
+}
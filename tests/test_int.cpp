@@ -510,6 +510,18 @@ TEST_CASE("Int")
         REQUIRE(Int::hyperoperation(4, 3, 3) == 7625597484987LL); // tetration
     }
 
+    SECTION("hash")
+    {
+        std::hash<Int> hash;
+        REQUIRE(hash(Int("18446744073709551617")) == hash(positive));
+        REQUIRE(hash(positive) != hash(negative));
+        REQUIRE(hash(zero) != hash(Int(1)));
+
+        // same chunks in different positions
+        REQUIRE(hash(Int("100000000200000000")) != hash(Int("200000000100000000")));
+        REQUIRE(hash(Int("100000000100000000")) != hash(Int("0")));
+    }
+
     SECTION("print")
     {
         std::ostringstream oss;
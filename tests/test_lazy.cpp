@@ -0,0 +1,114 @@
+#include "../sources/dict.hpp"
+#include "../sources/list.hpp"
+
+#include "tool.hpp"
+
+using namespace pyincpp;
+
+TEST_CASE("Lazy")
+{
+    List<int> empty;
+    List<int> some = {1, 2, 3, 4, 5, 6};
+
+    SECTION("collect")
+    {
+        REQUIRE(empty.lazy().collect() == List<int>());
+        REQUIRE(some.lazy().collect() == some);
+        REQUIRE(List<int>{1, 2, 3}.lazy().collect() == List<int>{1, 2, 3}); // owns the elements of the temporary list
+
+        REQUIRE(some.lazy().collect<Set<int>>() == Set<int>{1, 2, 3, 4, 5, 6});
+        REQUIRE(some.lazy().map([](int x)
+                                { return Pair<int, int>(x, x * x); })
+                    .collect<Dict<int, int>>() == Dict<int, int>{{1, 1}, {2, 4}, {3, 9}, {4, 16}, {5, 25}, {6, 36}});
+        REQUIRE(some.lazy().collect<std::vector<int>>() == std::vector<int>{1, 2, 3, 4, 5, 6});
+    }
+
+    SECTION("map_filter")
+    {
+        REQUIRE(some.lazy().map([](int x)
+                                { return x * 10; })
+                    .collect() == List<int>{10, 20, 30, 40, 50, 60});
+        REQUIRE(some.lazy().filter([](int x)
+                                   { return x % 2 == 0; })
+                    .collect() == List<int>{2, 4, 6});
+        REQUIRE(some.lazy().map([](int x)
+                                { return std::to_string(x); })
+                    .collect() == List<std::string>{"1", "2", "3", "4", "5", "6"});
+
+        // chained
+        auto lazy = some.lazy()
+                        .filter([](int x)
+                                { return x % 2 == 0; })
+                        .map([](int x)
+                             { return x * x; })
+                        .filter([](int x)
+                                { return x > 4; });
+        REQUIRE(lazy.collect() == List<int>{16, 36});
+        REQUIRE(lazy.collect() == List<int>{16, 36}); // can be collected again
+
+        // the list is not changed
+        REQUIRE(some == List<int>{1, 2, 3, 4, 5, 6});
+    }
+
+    SECTION("take_drop")
+    {
+        REQUIRE(some.lazy().take(3).collect() == List<int>{1, 2, 3});
+        REQUIRE(some.lazy().take(10).collect() == some);
+        REQUIRE(some.lazy().take(0).collect() == empty);
+        REQUIRE(some.lazy().drop(4).collect() == List<int>{5, 6});
+        REQUIRE(some.lazy().drop(10).collect() == empty);
+        REQUIRE(some.lazy().drop(1).take(3).collect() == List<int>{2, 3, 4}); // like slice(1, 4)
+
+        REQUIRE(some.lazy().take_while([](int x)
+                                       { return x < 3; })
+                    .collect() == List<int>{1, 2});
+        REQUIRE(some.lazy().drop_while([](int x)
+                                       { return x < 3; })
+                    .collect() == List<int>{3, 4, 5, 6});
+
+        REQUIRE_THROWS_MATCHES(some.lazy().take(-1), std::runtime_error, Message("Error: Require n >= 0 for take()."));
+        REQUIRE_THROWS_MATCHES(some.lazy().drop(-1), std::runtime_error, Message("Error: Require n >= 0 for drop()."));
+    }
+
+    SECTION("one_pass")
+    {
+        // the stages are fused, each element goes through the pipeline once
+        int calls = 0;
+        auto lazy = some.lazy()
+                        .map([&](int x)
+                             { return ++calls, x; })
+                        .filter([](int x)
+                                { return x % 2 == 1; });
+        REQUIRE(calls == 0);
+        REQUIRE(lazy.collect() == List<int>{1, 3, 5});
+        REQUIRE(calls == 6);
+
+        // computed elements are moved into the result
+        List<std::string> strs = {"a", "bb", "ccc"};
+        REQUIRE(strs.lazy().map([](const std::string& s)
+                                { return s + s; })
+                    .filter([](const std::string& s)
+                            { return s.size() > 2; })
+                    .take(1)
+                    .collect() == List<std::string>{"bbbb"});
+
+        // the pipeline over a temporary list can be copied
+        auto owned = List<int>{1, 2, 3}.lazy().map([](int x)
+                                                   { return x + 1; });
+        REQUIRE(owned.filter([](int x)
+                             { return x != 3; })
+                    .collect() == List<int>{2, 4});
+        REQUIRE(owned.collect() == List<int>{2, 3, 4});
+    }
+
+    SECTION("iterator")
+    {
+        int sum = 0;
+        for (int x : some.lazy().map([](int x)
+                                     { return x * 2; }))
+        {
+            sum += x;
+        }
+        REQUIRE(sum == 42);
+    }
+}
@@ -202,6 +202,23 @@ TEST_CASE("List")
         empty.insert(-1, -1);
         REQUIRE(empty == List<int>{1, 5, 233, -1, 999});
 
+        // move and emplace, move-only elements are never copied
+        List<std::unique_ptr<int>> ptrs;
+        ptrs += std::make_unique<int>(1);
+        ptrs.insert(0, std::make_unique<int>(0));
+        REQUIRE(*ptrs.emplace_back(new int(3)) == 3);
+        REQUIRE(*ptrs.emplace(-1, new int(2)) == 2);
+        REQUIRE(*ptrs.remove(0) == 0);
+        REQUIRE(*ptrs[0] + *ptrs[1] + *ptrs[2] == 6);
+
+        List<std::string> strs;
+        std::string long_str(100, 'a');
+        strs.insert(0, std::move(long_str));
+        REQUIRE(long_str.empty());
+        REQUIRE(strs.emplace(0, 3, 'b') == "bbb");
+        REQUIRE(strs == List<std::string>{"bbb", std::string(100, 'a')});
+        REQUIRE_THROWS_MATCHES(strs.emplace(3, "c"), std::runtime_error, Message("Error: Index out of range."));
+
         // check full
         // The test was successful! But the testing time is too long, and comment it out.
         // List<bool> big_list;
@@ -250,6 +267,12 @@ TEST_CASE("List")
         REQUIRE((empty += empty) == List<int>{2, 3, 3, 3, 3, 2, 3, 3, 3, 3});
         REQUIRE((empty += empty) == List<int>{2, 3, 3, 3, 3, 2, 3, 3, 3, 3, 2, 3, 3, 3, 3, 2, 3, 3, 3, 3});
         REQUIRE((empty += List<int>{0, 0}) == List<int>{2, 3, 3, 3, 3, 2, 3, 3, 3, 3, 2, 3, 3, 3, 3, 2, 3, 3, 3, 3, 0, 0});
+
+        // append moved list
+        List<std::string> strs;
+        List<std::string> moved = {"a", "b"};
+        REQUIRE((strs += std::move(moved)) == List<std::string>{"a", "b"});
+        REQUIRE((strs += List<std::string>{"c"}) == List<std::string>{"a", "b", "c"});
     }
 
     SECTION("remove_element")
@@ -312,6 +335,99 @@ TEST_CASE("List")
         REQUIRE((List<int>{1, 2, 3, 4, 5} <<= 5) == List<int>{1, 2, 3, 4, 5});
     }
 
+    SECTION("rotate_lazily")
+    {
+        RingList<int> list = {1, 2, 3, 4, 5};
+
+        // access by index without moving the elements
+        list <<= 2;
+        REQUIRE(list[0] == 3);
+        REQUIRE(list[2] == 5);
+        REQUIRE(list[3] == 1);
+        REQUIRE(list[-1] == 2);
+        list[-1] = 6;
+        list >>= 4;
+        REQUIRE(list[0] == 4);
+        REQUIRE(list[4] == 3);
+
+        // copy and move keep the rotation
+        RingList<int> copy = list;
+        REQUIRE(copy[0] == 4);
+        RingList<int> moved = std::move(copy);
+        REQUIRE(moved[0] == 4);
+        REQUIRE(copy.size() == 0);
+        copy += 0;
+        REQUIRE(copy == RingList<int>{0});
+
+        // contiguous access after rotations
+        REQUIRE(RingList<int>(list.begin(), list.end()) == RingList<int>{4, 5, 1, 6, 3});
+        list <<= 1;
+        list.insert(1, 7);
+        REQUIRE(list == RingList<int>{5, 7, 1, 6, 3, 4});
+        list >>= 2;
+        list += 8;
+        REQUIRE(list == RingList<int>{3, 4, 5, 7, 1, 6, 8});
+        list <<= 3;
+        REQUIRE(list.remove(0) == 7);
+        REQUIRE(list.index(6) == 1);
+        list >>= 1;
+        REQUIRE(list.slice(0, 3) == RingList<int>{5, 1, 6});
+        REQUIRE(list.sort() == RingList<int>{1, 3, 4, 5, 6, 8});
+
+        // the const members read the elements in place, without moving them
+        RingList<int> ring = {1, 2, 3, 4, 5};
+        ring >>= 1;
+        const int& first = ring[0];
+        const RingList<int>& view = ring;
+        REQUIRE(view == RingList<int>{5, 1, 2, 3, 4});
+        REQUIRE(view < RingList<int>{5, 2});
+        REQUIRE(RingList<int>(view.rbegin(), view.rend()) == RingList<int>{4, 3, 2, 1, 5});
+        REQUIRE(*view.find(2) == 2);
+        REQUIRE(view.find(2) - view.begin() == 2);
+        REQUIRE(view.index(4) == 4);
+        REQUIRE(view.count(5) == 1);
+        REQUIRE(view.slice(1, 4) == RingList<int>{1, 2, 3});
+        REQUIRE(view.slice(-1, 0, -1) == RingList<int>{4, 3, 2, 1});
+        REQUIRE(view.slice(0, 5, 2) == RingList<int>{5, 2, 4});
+        REQUIRE(view + 6 == RingList<int>{5, 1, 2, 3, 4, 6});
+        REQUIRE(view * 2 == RingList<int>{5, 1, 2, 3, 4, 5, 1, 2, 3, 4});
+        REQUIRE(view.lazy().take(2).collect() == List<int>{5, 1});
+        REQUIRE(view.par_find(1) == view.begin() + 1);
+        REQUIRE(view.par_reduce(std::plus<>()) == 15);
+        std::ostringstream oss;
+        oss << view;
+        REQUIRE(oss.str() == "[5, 1, 2, 3, 4]");
+        REQUIRE(&first == &ring[0]);
+        REQUIRE(first == 5);
+
+        // insert and remove the elements of the list itself after rotations
+        RingList<int> self = {1, 2, 3, 4};
+        self >>= 1;
+        self += self[0];
+        REQUIRE(self == RingList<int>{4, 1, 2, 3, 4});
+        self >>= 1;
+        self.insert(0, self[-1]);
+        REQUIRE(self == RingList<int>{3, 4, 4, 1, 2, 3});
+        self <<= 2;
+        self -= self[-1];
+        REQUIRE(self == RingList<int>{1, 2, 3, 3, 4});
+        self <<= 3;
+        self /= self[0];
+        REQUIRE(self == RingList<int>{4, 1, 2});
+
+        // a List without the ring stays on contiguous iterators
+        static_assert(std::contiguous_iterator<decltype(List<int>().begin())>);
+
+        // sliding window
+        RingList<int> window = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+        for (int i = 0; i < 25; ++i)
+        {
+            window <<= 3;
+            REQUIRE(window[0] == (i + 1) * 3 % 10);
+        }
+        REQUIRE(window == RingList<int>{5, 6, 7, 8, 9, 0, 1, 2, 3, 4});
+    }
+
     SECTION("reverse")
     {
         REQUIRE(empty.reverse() == empty);
@@ -324,6 +440,27 @@ TEST_CASE("List")
         REQUIRE(List<int>{1, 2, 2, 3, 3, 3}.uniquify() == List<int>{1, 2, 3});
         REQUIRE(List<int>{1, 2, 3, 1, 2, 3, 1, 2, 3}.uniquify() == List<int>{1, 2, 3});
         REQUIRE((List<int>{0} * 10000).uniquify() == List<int>{0});
+        REQUIRE(List<int>().uniquify() == List<int>());
+
+        // hashable
+        REQUIRE(List<std::string>{"b", "a", "b", "c", "a"}.uniquify() == List<std::string>{"b", "a", "c"});
+        List<int> large;
+        for (int i = 0; i < 10000; ++i)
+        {
+            large += (i * 7919) % 1000 - 500; // each of -500..499 ten times
+        }
+        List<int> expected;
+        for (int i = 0; i < 1000; ++i)
+        {
+            expected += (i * 7919) % 1000 - 500;
+        }
+        REQUIRE(large.uniquify() == expected);
+
+        // only ordered
+        REQUIRE(List<List<int>>{{2}, {1}, {2}, {}, {1}}.uniquify() == List<List<int>>{{2}, {1}, {}});
+
+        // only equality comparable
+        REQUIRE(List<EqType>{1, 2, 3}.uniquify().size() == 1);
     }
 
     SECTION("sort")
@@ -362,6 +499,94 @@ TEST_CASE("List")
                                         {"Mei", 17},
                                         {"Sakura", 19},
                                         {"Yuzu", 18}});
+
+        // sort by key
+        persons.sort([](const Person& person)
+                     { return person.age; });
+        REQUIRE(persons == List<Person>{{"Mei", 17},
+                                        {"Alice", 18},
+                                        {"Yuzu", 18},
+                                        {"Sakura", 19},
+                                        {"Homura", 20}});
+
+        // reversed, still stable
+        persons.sort(&Person::age, true);
+        REQUIRE(persons == List<Person>{{"Homura", 20},
+                                        {"Sakura", 19},
+                                        {"Alice", 18},
+                                        {"Yuzu", 18},
+                                        {"Mei", 17}});
+        list.sort({}, true);
+        REQUIRE(list == List<int>{9, 8, 7, 6, 5, 4, 3, 2, 1, 0});
+
+        // capturing comparator
+        int pivot = 5;
+        list.sort([pivot](int e1, int e2)
+                  { return std::abs(e1 - pivot) < std::abs(e2 - pivot); });
+        REQUIRE(list == List<int>{5, 6, 4, 7, 3, 8, 2, 9, 1, 0});
+
+        // parallel
+        std::mt19937 gen(233);
+        List<int> large;
+        for (int i = 0; i < 500000; ++i)
+        {
+            large += std::uniform_int_distribution<int>(0, 1000)(gen);
+        }
+        List<int> expected = large;
+        expected.sort([](int e)
+                      { return e / 10; }); // stable
+        REQUIRE(List<int>(large).parallel_sort([](int e1, int e2)
+                                               { return e1 / 10 < e2 / 10; }) == expected);
+        REQUIRE(List<int>(large).parallel_sort([](int e)
+                                               { return e / 10; }) == expected);
+        REQUIRE(List<int>(large).parallel_sort({}, true) == List<int>(large).sort(std::greater<>()));
+
+        // radix sort, checked against comparison sort
+        auto check = [](const auto& list)
+        {
+            using T = std::decay_t<decltype(list[0])>;
+            auto by_less = [](const T& e1, const T& e2)
+            { return e1 < e2; };
+            auto by_greater = [](const T& e1, const T& e2)
+            { return e2 < e1; };
+            REQUIRE(List<T>(list).sort() == List<T>(list).sort(by_less));
+            REQUIRE(List<T>(list).sort({}, true) == List<T>(list).sort(by_greater));
+        };
+        List<long long> longs;
+        List<unsigned> uints;
+        List<double> doubles;
+        List<std::string> strings;
+        for (int i = 0; i < 5000; ++i)
+        {
+            longs += static_cast<long long>(gen() << (i % 32)) * (i % 2 ? 1 : -1);
+            uints += gen() % 1000;
+            doubles += i % 100 == 0 ? 0.0 : (i % 100 == 1 ? -0.0 : std::uniform_real_distribution<double>(-1e9, 1e9)(gen));
+            strings += std::string(gen() % 4, 'a' + gen() % 3) + std::string(gen() % 40, char(gen() % 256));
+        }
+        check(longs);
+        check(uints);
+        check(doubles);
+        check(strings);
+        check(List<int>{3, 1, 2});
+
+        // -0.0 is equal to 0.0, so they keep their order
+        REQUIRE(std::signbit((List<double>{-0.0, 0.0} * 300).sort()[0]));
+        REQUIRE(!std::signbit((List<double>{0.0, -0.0} * 300).sort()[0]));
+
+        // radix sort by keys is stable
+        List<std::string> names;
+        for (int i = 0; i < 3000; ++i)
+        {
+            names += std::string(1, 'a' + i % 3) + std::to_string(i);
+        }
+        auto first_char = [](const std::string& e1, const std::string& e2)
+        { return e1[0] < e2[0]; };
+        auto first_char_reversed = [](const std::string& e1, const std::string& e2)
+        { return e2[0] < e1[0]; };
+        REQUIRE(List<std::string>(names).sort([](const std::string& e)
+                                              { return e[0]; }) == List<std::string>(names).sort(first_char));
+        REQUIRE(List<std::string>(names).sort([](const std::string& e)
+                                              { return e.substr(0, 1); }, true) == List<std::string>(names).sort(first_char_reversed));
     }
 
     SECTION("erase")
@@ -416,6 +641,77 @@ TEST_CASE("List")
         std::vector<int> v = {0, 9};
         empty.extend(v.begin(), v.end());
         REQUIRE(empty == List<int>{1, 1, 2, 3, 4, 5, 0, 9});
+
+        // extend from input iterators which can not be measured
+        std::istringstream iss("7 8");
+        empty.extend(std::istream_iterator<int>(iss), std::istream_iterator<int>());
+        REQUIRE(empty == List<int>{1, 1, 2, 3, 4, 5, 0, 9, 7, 8});
+    }
+
+    SECTION("parallel")
+    {
+        List<int> large;
+        for (int i = 0; i < 100000; ++i)
+        {
+            large += i;
+        }
+
+        // par_map
+        REQUIRE(List<int>(large).par_map([](int& x)
+                                         { x *= 2; }) == List<int>(large).map([](int& x)
+                                                                              { x *= 2; }));
+        REQUIRE(empty.par_map([](int& x)
+                              { x *= 2; }) == empty);
+
+        // par_filter keeps the order
+        auto one_mod_three = [](int& x)
+        { return x % 3 == 1; };
+        REQUIRE(List<int>(large).par_filter(one_mod_three) == List<int>(large).filter(one_mod_three));
+        REQUIRE(List<int>(large).par_filter([](int& x)
+                                            { return x >= 99990; }) == List<int>{99990, 99991, 99992, 99993, 99994, 99995, 99996, 99997, 99998, 99999});
+        REQUIRE(List<int>(large).par_filter([](int& x)
+                                            { return x < 0; }) == empty);
+        REQUIRE(some.par_filter(one_mod_three) == List<int>{1, 4});
+
+        // the chunks of List<bool> do not share words of the bits
+        List<bool> bits;
+        for (int i = 0; i < 100000; ++i)
+        {
+            bits += i % 3 == 1;
+        }
+        auto flip = [](auto&& bit)
+        { bit = !bit; };
+        REQUIRE(List<bool>(bits).par_map(flip) == List<bool>(bits).map(flip));
+        REQUIRE(List<bool>(bits).par_filter([](bool bit)
+                                            { return bit; })
+                    .size() == 33333);
+
+        // par_reduce
+        auto add = [](long long a, long long b)
+        { return a + b; };
+        REQUIRE(List<long long>(large.begin(), large.end()).par_reduce(add) == 4999950000LL);
+        REQUIRE(List<long long>(large.begin(), large.end()).par_reduce(add, 1) == 4999950001LL);
+        REQUIRE(List<std::string>{"a", "b", "c"}.par_reduce(std::plus<>()) == "abc");
+        REQUIRE(empty.par_reduce(add, 233) == 233);
+        REQUIRE_THROWS_MATCHES(empty.par_reduce(add), std::runtime_error, Message("Error: The container is empty."));
+
+        // par_count
+        REQUIRE(large.par_count(12345) == 1);
+        REQUIRE(large.par_count(-1) == 0);
+        REQUIRE(large.par_count([](int x)
+                                { return x % 2 == 0; }) == 50000);
+
+        // par_find
+        REQUIRE(large.par_find(12345) == large.begin() + 12345);
+        REQUIRE(large.par_find(-1) == large.end());
+        REQUIRE(large.par_find([](int x)
+                               { return x > 0 && x % 20000 == 0; }) == large.begin() + 20000);
+        REQUIRE(empty.par_find(1) == empty.end());
+
+        // exceptions are rethrown
+        REQUIRE_THROWS_MATCHES(List<int>(large).par_map([](int& x)
+                                                        { x = x == 50000 ? throw std::runtime_error("Error: 50000.") : x; }),
+                               std::runtime_error, Message("Error: 50000."));
     }
 
     SECTION("clear")
@@ -448,6 +744,11 @@ TEST_CASE("List")
         REQUIRE(some.slice(-1, -1) == List<int>{});
         REQUIRE(some.slice(-1, -1, -1) == List<int>{});
 
+        REQUIRE(some.slice(0, 5, 3) == List<int>{1, 4});
+        REQUIRE(some.slice(4, 0, -3) == List<int>{5, 2});
+        REQUIRE(some.slice(0, 5, 10) == List<int>{1});
+        REQUIRE(some.slice(-1, -6, -10) == List<int>{5});
+
         REQUIRE_THROWS_MATCHES(some.slice(1, 2, 0), std::runtime_error, Message("Error: Require step != 0 for slice(start, stop, step)."));
 
         REQUIRE_THROWS_MATCHES(some.slice(-7, -6), std::runtime_error, Message("Error: Index out of range."));
@@ -458,6 +759,10 @@ TEST_CASE("List")
         // operator+
         REQUIRE(some + 6 == List<int>{1, 2, 3, 4, 5, 6});
         REQUIRE(some + List<int>{6, 7} == List<int>{1, 2, 3, 4, 5, 6, 7});
+        REQUIRE(some + some + some == some * 3);
+        REQUIRE(List<int>{0} + some + List<int>{6} == List<int>{0, 1, 2, 3, 4, 5, 6});
+        REQUIRE(empty + empty == empty);
+        REQUIRE(some == List<int>{1, 2, 3, 4, 5});
 
         // operator-
         REQUIRE(some - 5 == List<int>{1, 2, 3, 4});
@@ -467,6 +772,7 @@ TEST_CASE("List")
         REQUIRE(some * 0 == List<int>{});
         REQUIRE(some * 1 == List<int>{1, 2, 3, 4, 5});
         REQUIRE(some * 2 == List<int>{1, 2, 3, 4, 5, 1, 2, 3, 4, 5});
+        REQUIRE((List<EqType>{1, 2} * 2).size() == 4); // no default constructor
 
         // operator/
         REQUIRE(some / 5 == List<int>{1, 2, 3, 4});
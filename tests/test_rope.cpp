@@ -0,0 +1,201 @@
+#include "../sources/rope.hpp"
+
+#include "tool.hpp"
+
+using namespace pyincpp;
+
+TEST_CASE("Rope")
+{
+    Rope empty;
+    Rope one = "1";
+    Rope some = Rope("12") + Rope("3") + Rope("45");
+
+    SECTION("basics")
+    {
+        REQUIRE(empty.size() == 0);
+        REQUIRE(empty.is_empty());
+        REQUIRE(empty.chunk_count() == 0);
+
+        REQUIRE(one.size() == 1);
+        REQUIRE(!one.is_empty());
+
+        REQUIRE(some.size() == 5);
+        REQUIRE(some.to_str() == "12345");
+
+        REQUIRE(Rope(Str("hello")).to_str() == "hello");
+        REQUIRE(Rope(std::string("hello")).to_str() == "hello");
+        REQUIRE(Rope("").is_empty());
+    }
+
+    SECTION("compare")
+    {
+        REQUIRE(some == Rope("12345"));
+        REQUIRE(some == Rope("1") + Rope("2345"));
+        REQUIRE(some != Rope("12346"));
+        REQUIRE(some != Rope("1234"));
+        REQUIRE(empty == Rope());
+    }
+
+    SECTION("access")
+    {
+        REQUIRE(some[0] == '1');
+        REQUIRE(some[4] == '5');
+        REQUIRE(some[-1] == '5');
+        REQUIRE(some[-5] == '1');
+
+        REQUIRE_THROWS_MATCHES(some[5], std::runtime_error, Message("Error: Index out of range."));
+        REQUIRE_THROWS_MATCHES(some[-6], std::runtime_error, Message("Error: Index out of range."));
+    }
+
+    SECTION("data")
+    {
+        REQUIRE(std::string_view(empty.data(), empty.size()) == "");
+
+        // large chunks are shared, not merged
+        Rope large = Rope(std::string(1000, 'a')) + Rope(std::string(1000, 'b'));
+        REQUIRE(large.chunk_count() == 2);
+        REQUIRE(std::string_view(large.data(), large.size()) == std::string(1000, 'a') + std::string(1000, 'b'));
+        REQUIRE(large.chunk_count() == 1);
+
+        // a slice of a flattened rope is not null-terminated
+        Rope part = large.slice(0, 1000);
+        REQUIRE(std::string_view(part.data(), part.size()) == std::string(1000, 'a'));
+    }
+
+    SECTION("chunks")
+    {
+        Rope rope = Rope(std::string(300, 'a')) + Rope(std::string(300, 'b'));
+        REQUIRE(rope.chunks() == List<std::string_view>{std::string(300, 'a'), std::string(300, 'b')});
+
+        // short chunks are merged
+        REQUIRE(some.chunks() == List<std::string_view>{"12345"});
+    }
+
+    SECTION("find")
+    {
+        REQUIRE(some.find("") == 0);
+        REQUIRE(some.find("1") == 0);
+        REQUIRE(some.find("45") == 3);
+        REQUIRE(some.find("6") == -1);
+        REQUIRE(some.find("3", 3) == -1);
+        REQUIRE(some.find("3", 0, 2) == -1);
+
+        REQUIRE(some.contains("234"));
+        REQUIRE(!some.contains("54"));
+
+        // occurrences across the boundaries of chunks, found without flattening
+        Rope rope = Rope(std::string(300, 'a') + "xy") + Rope("z" + std::string(300, 'b')) + Rope(std::string(300, 'c'));
+        REQUIRE(rope.chunk_count() == 3);
+        REQUIRE(rope.find("xyz") == 300);
+        REQUIRE(rope.find("abbb") == -1);
+        REQUIRE(rope.find("bc") == 602);
+        REQUIRE(rope.find("ac") == -1);
+        REQUIRE(rope.find("b", 400) == 400);
+        REQUIRE(rope.find("c", 0, 603) == -1);
+        REQUIRE(rope.find("y" + std::string(301, 'z')) == -1);
+        REQUIRE(rope.find("yz" + std::string(300, 'b') + "c") == 301);
+        REQUIRE(rope.chunk_count() == 3);
+    }
+
+    SECTION("slice")
+    {
+        REQUIRE(some.slice(0, 5) == some);
+        REQUIRE(some.slice(1, -1) == "234");
+        REQUIRE(some.slice(-3, 5) == "345");
+        REQUIRE(some.slice(3, 1) == "");
+        REQUIRE(empty.slice(0, 0) == "");
+
+        REQUIRE_THROWS_MATCHES(some.slice(6, 7), std::runtime_error, Message("Error: Index out of range."));
+        REQUIRE_THROWS_MATCHES(some.slice(0, 7), std::runtime_error, Message("Error: Index out of range."));
+    }
+
+    SECTION("erase_insert")
+    {
+        REQUIRE(some.erase(0, 1) == "2345");
+        REQUIRE(some.erase(1, 4) == "15");
+        REQUIRE(some.erase(0, 5) == "");
+        REQUIRE(some.erase(3, 1) == some);
+        REQUIRE(some.erase(-2, 5) == "123");
+        REQUIRE(some.erase(1, -1) == "15");
+
+        REQUIRE(some.insert(0, "0") == "012345");
+        REQUIRE(some.insert(5, "6") == "123456");
+        REQUIRE(some.insert(2, "ab") == "12ab345");
+        REQUIRE(some.insert(-1, "ab") == "1234ab5");
+
+        REQUIRE_THROWS_MATCHES(some.erase(-6, 3), std::runtime_error, Message("Error: Index out of range."));
+        REQUIRE_THROWS_MATCHES(some.insert(6, "x"), std::runtime_error, Message("Error: Index out of range."));
+        REQUIRE_THROWS_MATCHES(some.insert(-6, "x"), std::runtime_error, Message("Error: Index out of range."));
+    }
+
+    SECTION("split")
+    {
+        Rope rope = Rope("one, two") + Rope(", three");
+        REQUIRE(rope.split(", ") == List<Str>{"one", "two", "three"});
+        REQUIRE(Rope("   1   2   3   ").split() == List<Str>{"1", "2", "3"});
+        REQUIRE(Rope("aaa").split("a", true) == List<Str>{"", "", "", ""});
+
+        // separators across the boundaries of chunks
+        Rope lines = Rope(std::string(300, 'a') + "\r") + Rope("\n" + std::string(300, 'b') + "\r\n");
+        REQUIRE(lines.split("\r\n") == List<Str>{std::string(300, 'a'), std::string(300, 'b')});
+        REQUIRE(lines.to_str() == std::string(300, 'a') + "\r\n" + std::string(300, 'b') + "\r\n");
+        REQUIRE(lines.chunk_count() == 2);
+
+        REQUIRE_THROWS_MATCHES(rope.split(""), std::runtime_error, Message("Error: Empty separator."));
+    }
+
+    SECTION("random")
+    {
+        // random edits on a large rope, checked against std::string
+        std::mt19937 gen(233);
+        std::string expected;
+        Rope rope;
+        for (int i = 0; i < 2000; ++i)
+        {
+            const int pos = std::uniform_int_distribution<int>(0, expected.size())(gen);
+            const int op = std::uniform_int_distribution<int>(0, 3)(gen);
+            if (op <= 1) // insert
+            {
+                std::string text(std::uniform_int_distribution<int>(1, 600)(gen), 'a' + i % 26);
+                expected.insert(pos, text);
+                rope = rope.insert(pos, text);
+            }
+            else if (op == 2) // erase
+            {
+                const int stop = std::uniform_int_distribution<int>(pos, expected.size())(gen);
+                expected.erase(pos, stop - pos);
+                rope = rope.erase(pos, stop);
+            }
+            else // slice and concatenate
+            {
+                rope = rope.slice(pos, rope.size()) + rope.slice(0, pos);
+                expected = expected.substr(pos) + expected.substr(0, pos);
+            }
+            REQUIRE(rope.size() == int(expected.size()));
+
+            // search for a part of the text, which often crosses a boundary of chunks
+            if (i % 10 == 0 && !expected.empty())
+            {
+                const int from = std::uniform_int_distribution<int>(0, expected.size() - 1)(gen);
+                const std::string part = expected.substr(from, 40);
+                REQUIRE(rope.find(part) == int(expected.find(part)));
+                REQUIRE(rope.find(part, from / 2) == int(expected.find(part, from / 2)));
+            }
+        }
+        REQUIRE(rope.to_str() == Str(expected));
+        REQUIRE(rope[expected.size() / 2] == expected[expected.size() / 2]);
+    }
+
+    SECTION("print")
+    {
+        std::ostringstream oss;
+
+        oss << empty;
+        REQUIRE(oss.str() == "\"\"");
+        oss.str("");
+
+        oss << some;
+        REQUIRE(oss.str() == "\"12345\"");
+        oss.str("");
+    }
+}
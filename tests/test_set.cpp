@@ -128,6 +128,13 @@ TEST_CASE("Set")
         REQUIRE(some.contains(1) == true);
         REQUIRE(some.contains(0) == false);
 
+        // heterogeneous lookup
+        Set<std::string> strs{"one", "two", "three"};
+        REQUIRE(*strs.find("two") == "two");
+        REQUIRE(strs.find(std::string_view("four")) == strs.end());
+        REQUIRE(strs.contains("one"));
+        REQUIRE(!strs.contains(std::string_view("four")));
+
         // min
         REQUIRE(some.min() == 1);
         REQUIRE_THROWS_MATCHES(empty.min(), std::runtime_error, Message("Error: The container is empty."));
@@ -0,0 +1,182 @@
+#include "../sources/list.hpp"
+#include "../sources/str.hpp"
+
+#include "tool.hpp"
+
+using namespace pyincpp;
+
+TEST_CASE("SmallList")
+{
+    SmallList<int, 4> empty;
+    SmallList<int, 4> some = {1, 2, 3};
+    SmallList<int, 4> many = {1, 2, 3, 4, 5, 6};
+
+    SECTION("basics")
+    {
+        REQUIRE(empty.size() == 0);
+        REQUIRE(empty.is_empty());
+        REQUIRE(some.size() == 3);
+        REQUIRE(many.size() == 6);
+
+        REQUIRE(SmallList<int, 4>(many.begin(), many.end()) == many);
+        REQUIRE(SmallList<int, 4>(std::vector<int>{1, 2, 3}) == some);
+        REQUIRE(SmallList<Str>{"a", "b"}.size() == 2);
+    }
+
+    SECTION("compare")
+    {
+        REQUIRE(some == SmallList<int, 4>{1, 2, 3});
+        REQUIRE(some != many);
+        REQUIRE(some < many);
+        REQUIRE(SmallList<int, 4>{1, 2, 4} > many);
+        REQUIRE(empty < some);
+
+        // elements which only have `==` and `<`
+        REQUIRE((SmallList<EqLtType, 2>{1, 2, 3} == SmallList<EqLtType, 2>{1, 2, 3}));
+        REQUIRE((SmallList<EqLtType, 2>{1, 2, 3} < SmallList<EqLtType, 2>{1, 2, 3}) == (List<EqLtType>{1, 2, 3} < List<EqLtType>{1, 2, 3}));
+    }
+
+    SECTION("copy_move")
+    {
+        // inline and heap lists are copied and moved both ways
+        SmallList<Str, 2> small = {"short", "strings"};
+        SmallList<Str, 2> large = {"a", "b", "c", "d"};
+
+        SmallList<Str, 2> copy = small;
+        REQUIRE(copy == small);
+        copy = large;
+        REQUIRE(copy == large);
+        copy = small;
+        REQUIRE(copy == small);
+
+        SmallList<Str, 2> moved = std::move(copy);
+        REQUIRE(moved == small);
+        moved = SmallList<Str, 2>(large);
+        REQUIRE(moved == large);
+        moved = SmallList<Str, 2>(small);
+        REQUIRE(moved == small);
+
+        // move-only elements
+        SmallList<std::unique_ptr<int>, 2> ptrs;
+        for (int i = 0; i < 5; ++i)
+        {
+            ptrs += std::make_unique<int>(i);
+        }
+        SmallList<std::unique_ptr<int>, 2> other = std::move(ptrs);
+        REQUIRE(*other[-1] == 4);
+        REQUIRE(*other.remove(0) == 0);
+    }
+
+    SECTION("access")
+    {
+        REQUIRE(many[0] == 1);
+        REQUIRE(many[-1] == 6);
+        many[5] = 0;
+        REQUIRE(many == SmallList<int, 4>{1, 2, 3, 4, 5, 0});
+
+        REQUIRE_THROWS_MATCHES(some[3], std::runtime_error, Message("Error: Index out of range."));
+        REQUIRE_THROWS_MATCHES(some[-4], std::runtime_error, Message("Error: Index out of range."));
+    }
+
+    SECTION("manipulation")
+    {
+        // grow beyond the inline capacity
+        empty += 1;
+        empty.insert(0, 0);
+        empty.emplace_back(3);
+        empty.emplace(2, 2);
+        REQUIRE(empty == SmallList<int, 4>{0, 1, 2, 3});
+        empty += 4;
+        REQUIRE(empty == SmallList<int, 4>{0, 1, 2, 3, 4});
+        REQUIRE(empty.remove(-1) == 4);
+        REQUIRE((empty -= 0) == SmallList<int, 4>{1, 2, 3});
+
+        // extend with itself
+        REQUIRE((some += some) == SmallList<int, 4>{1, 2, 3, 1, 2, 3});
+        some.extend(some.begin(), some.begin() + 2);
+        REQUIRE(some == SmallList<int, 4>{1, 2, 3, 1, 2, 3, 1, 2});
+
+        REQUIRE((many >>= 2) == SmallList<int, 4>{5, 6, 1, 2, 3, 4});
+        REQUIRE((many <<= 2) == SmallList<int, 4>{1, 2, 3, 4, 5, 6});
+        REQUIRE(many.reverse() == SmallList<int, 4>{6, 5, 4, 3, 2, 1});
+        REQUIRE(many.sort() == SmallList<int, 4>{1, 2, 3, 4, 5, 6});
+        REQUIRE(many.erase(1, 5) == SmallList<int, 4>{1, 6});
+        REQUIRE(SmallList<int, 4>{3, 1, 3, 2, 1}.uniquify() == SmallList<int, 4>{3, 1, 2});
+
+        REQUIRE(SmallList<int, 4>{1, 2, 3, 4, 5, 6}.map([](int& x)
+                                                        { x *= 2; })
+                    .filter([](int x)
+                            { return x > 4; }) == SmallList<int, 4>{6, 8, 10, 12});
+    }
+
+    SECTION("production")
+    {
+        REQUIRE(many.slice(1, -1) == SmallList<int, 4>{2, 3, 4, 5});
+        REQUIRE(many.slice(-1, -7, -2) == SmallList<int, 4>{6, 4, 2});
+        REQUIRE(some + 4 == SmallList<int, 4>{1, 2, 3, 4});
+        REQUIRE(some + some == SmallList<int, 4>{1, 2, 3, 1, 2, 3});
+        REQUIRE(some * 2 == some + some);
+        REQUIRE(many - 6 == SmallList<int, 4>{1, 2, 3, 4, 5});
+        REQUIRE(many.lazy().filter([](int x)
+                                   { return x % 2 == 0; })
+                    .collect<SmallList<int, 4>>() == SmallList<int, 4>{2, 4, 6});
+        REQUIRE(SmallList<int, 4>{1, 2, 3, 4, 5}.lazy().take(2).collect() == List<int>{1, 2});
+    }
+
+    SECTION("random")
+    {
+        // random edits, checked against List
+        std::mt19937 gen(233);
+        List<int> expected;
+        SmallList<int, 8> small;
+        for (int i = 0; i < 2000; ++i)
+        {
+            const int op = std::uniform_int_distribution<int>(0, 4)(gen);
+            const int pos = std::uniform_int_distribution<int>(0, expected.size())(gen);
+            if (op <= 1 || expected.is_empty()) // insert
+            {
+                expected.insert(pos, i);
+                small.insert(pos, i);
+            }
+            else if (op == 2) // remove
+            {
+                REQUIRE(small.remove(pos % small.size()) == expected.remove(pos % expected.size()));
+            }
+            else if (op == 3) // rotate
+            {
+                expected >>= pos;
+                small >>= pos;
+            }
+            else if (expected.size() > 16) // shrink to a few elements
+            {
+                expected = expected.slice(0, 4);
+                small = small.slice(0, 4);
+            }
+            REQUIRE(List<int>(small.begin(), small.end()) == expected);
+        }
+
+        // radix sort of the large list
+        SmallList<int, 8> large;
+        for (int i = 0; i < 1000; ++i)
+        {
+            large += std::uniform_int_distribution<int>(-1000, 1000)(gen);
+        }
+        std::vector<int> sorted(large.begin(), large.end());
+        std::sort(sorted.begin(), sorted.end());
+        large.sort();
+        REQUIRE(List<int>(large.begin(), large.end()) == List<int>(sorted));
+    }
+
+    SECTION("print")
+    {
+        std::ostringstream oss;
+
+        oss << empty;
+        REQUIRE(oss.str() == "[]");
+        oss.str("");
+
+        oss << many;
+        REQUIRE(oss.str() == "[1, 2, 3, 4, 5, 6]");
+        oss.str("");
+    }
+}
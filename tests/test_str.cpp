@@ -73,6 +73,42 @@ TEST_CASE("Str")
         REQUIRE(gt_str >= some);
         REQUIRE(gt_str2 >= some);
         REQUIRE(eq_str >= some);
+
+        // with cached hashes
+        std::hash<Str>()(some);
+        std::hash<Str>()(eq_str);
+        std::hash<Str>()(gt_str2);
+        REQUIRE(eq_str == some);
+        REQUIRE(Str("12346") != some);
+        REQUIRE(Str("1") != gt_str2);
+
+        // with string-like objects
+        REQUIRE(some == "12345");
+        REQUIRE(some == std::string_view("12345"));
+        REQUIRE(some == std::string("12345"));
+        REQUIRE("12345" == some);
+        REQUIRE(some != "1234");
+        REQUIRE(some < "2");
+        REQUIRE(some > std::string_view("12344"));
+        REQUIRE(empty < "0");
+
+        // common_prefix
+        REQUIRE(some.common_prefix(eq_str) == 5);
+        REQUIRE(some.common_prefix(lt_str) == 3);
+        REQUIRE(some.common_prefix(gt_str2) == 0);
+        REQUIRE(some.common_prefix(empty) == 0);
+        Str long_str = "abcdefghijklmnopqrstuvwxyz";
+        REQUIRE(long_str.common_prefix("abcdefghijklmnopqrstuvwxyz") == 26);
+        REQUIRE(long_str.common_prefix("abcdefghijklmnopQrstuvwxyz") == 16);
+        REQUIRE(long_str.common_prefix("abcdefghiJklmnopqrstuvwxyz") == 9);
+        REQUIRE(long_str.common_prefix("abcdefghijklmnopqrstuvwxyz!") == 26);
+
+        // compare
+        REQUIRE((some.compare(eq_str) == 0));
+        REQUIRE((some.compare(lt_str, 3) > 0));
+        REQUIRE((some.compare(gt_str, 5) < 0));
+        REQUIRE((some.compare(gt_str2) < 0));
+        REQUIRE((long_str.compare("abcdefghijklmnopQrstuvwxyz", 16) > 0));
     }
 
     SECTION("assignment")
@@ -231,6 +267,38 @@ TEST_CASE("Str")
         REQUIRE(Str("-.1e-1").to_decimal() == Approx(-.1e-1));
         REQUIRE(Str("-.1e+123").to_decimal() == Approx(-.1e+123));
 
+        // blank, infinity and nan
+        REQUIRE(Str("  \t1.5\r\n").to_decimal() == 1.5);
+        REQUIRE(Str("-Infinity").to_decimal() == -INFINITY);
+        REQUIRE(Str("+INF").to_decimal() == INFINITY);
+        REQUIRE(std::isnan(Str("-NaN").to_decimal()));
+
+        // exact
+        REQUIRE(Str("0.1").to_decimal() == 0.1);
+        REQUIRE(Str("123456789012345678901234567890").to_decimal() == 123456789012345678901234567890.0);
+        REQUIRE(Str("0.000000000000000000000000000001234567890123456789").to_decimal() == 0.000000000000000000000000000001234567890123456789);
+        REQUIRE(Str("9007199254740993").to_decimal() == 9007199254740993.0);
+        REQUIRE(Str("2.2250738585072011e-308").to_decimal() == 2.2250738585072011e-308);
+        REQUIRE(Str("1.7976931348623157e308").to_decimal() == 1.7976931348623157e308);
+        REQUIRE(Str("4.9e-324").to_decimal() == 4.9e-324);
+        REQUIRE(Str("-1e-400").to_decimal() == 0);
+        REQUIRE(Str("-1e+400").to_decimal() == -HUGE_VAL);
+        REQUIRE(Str("0.0000000001e+400").to_decimal() == HUGE_VAL);
+        REQUIRE(Str("0e999999999").to_decimal() == 0);
+
+        // round trip
+        std::mt19937_64 gen(233);
+        for (int i = 0; i < 10000; ++i)
+        {
+            double x = std::bit_cast<double>(gen());
+            if (std::isfinite(x))
+            {
+                char buffer[32];
+                std::snprintf(buffer, sizeof(buffer), "%.17g", x);
+                REQUIRE(Str(buffer).to_decimal() == x);
+            }
+        }
+
         // error
         REQUIRE_THROWS_MATCHES(Str("+").to_decimal(), std::runtime_error, Message("Error: Invalid literal for to_decimal()."));
         REQUIRE_THROWS_MATCHES(Str(".").to_decimal(), std::runtime_error, Message("Error: Invalid literal for to_decimal()."));
@@ -238,6 +306,24 @@ TEST_CASE("Str")
         REQUIRE_THROWS_MATCHES(Str("1 1").to_decimal(), std::runtime_error, Message("Error: Invalid literal for to_decimal()."));
         REQUIRE_THROWS_MATCHES(Str("123a").to_decimal(), std::runtime_error, Message("Error: Invalid literal for to_decimal()."));
         REQUIRE_THROWS_MATCHES(Str("hello").to_decimal(), std::runtime_error, Message("Error: Invalid literal for to_decimal()."));
+        REQUIRE_THROWS_MATCHES(Str("").to_decimal(), std::runtime_error, Message("Error: Invalid literal for to_decimal()."));
+        REQUIRE_THROWS_MATCHES(Str("1e").to_decimal(), std::runtime_error, Message("Error: Invalid literal for to_decimal()."));
+        REQUIRE_THROWS_MATCHES(Str(".e1").to_decimal(), std::runtime_error, Message("Error: Invalid literal for to_decimal()."));
+        REQUIRE_THROWS_MATCHES(Str("info").to_decimal(), std::runtime_error, Message("Error: Invalid literal for to_decimal()."));
+    }
+
+    SECTION("parse_decimals")
+    {
+        REQUIRE(Str("").parse_decimals() == List<double>{});
+        REQUIRE(Str(" \n ").parse_decimals() == List<double>{});
+        REQUIRE(Str("1.5 2e3\n-3").parse_decimals() == List<double>{1.5, 2000, -3});
+        REQUIRE(Str("1, 2.5 ,-inf,.5").parse_decimals() == List<double>{1, 2.5, -INFINITY, 0.5});
+        REQUIRE(Str("12345678901234567890.5\r\n0.25\r\n").parse_decimals() == List<double>{12345678901234567890.5, 0.25});
+
+        REQUIRE_THROWS_MATCHES(Str("1,,2").parse_decimals(), std::runtime_error, Message("Error: Invalid literal for parse_decimals()."));
+        REQUIRE_THROWS_MATCHES(Str("1,2,").parse_decimals(), std::runtime_error, Message("Error: Invalid literal for parse_decimals()."));
+        REQUIRE_THROWS_MATCHES(Str("1;2").parse_decimals(), std::runtime_error, Message("Error: Invalid literal for parse_decimals()."));
+        REQUIRE_THROWS_MATCHES(Str("1 abc").parse_decimals(), std::runtime_error, Message("Error: Invalid literal for parse_decimals()."));
     }
 
     SECTION("to_integer")
@@ -270,10 +356,68 @@ TEST_CASE("Str")
         REQUIRE(Str("+0101").to_integer(2) == 5);
         REQUIRE(Str("+1010").to_integer(2) == 10);
         REQUIRE(Str("\n\r\n\t  233  \t\r\n\r").to_integer() == 233);
+        REQUIRE(Str("123456789123456789123456789").to_integer() == Int("123456789123456789123456789"));
+        REQUIRE(Str("-1000000000000000000000000000").to_integer() == Int("-1000000000000000000000000000"));
+        REQUIRE(Str("ffffffffffffffffffffffffffffffff").to_integer(16) == Int("340282366920938463463374607431768211455"));
+        REQUIRE(Str("zzzzzzzzzzzzzzzzzzzz").to_integer(36) == Int::pow(36, 20) - 1);
+        REQUIRE(Str("1111111111111111111111111111111111111111111111111111111111111111").to_integer(2) == Int("18446744073709551615"));
+        REQUIRE(Str("  0000000000000000000000000000000000012  ").to_integer(3) == 5);
 
         // error
         REQUIRE_THROWS_MATCHES(Str("123").to_integer(99), std::runtime_error, Message("Error: Invalid base for to_integer()."));
         REQUIRE_THROWS_MATCHES(Str("!!!").to_integer(), std::runtime_error, Message("Error: Invalid literal for to_integer()."));
+        REQUIRE_THROWS_MATCHES(Str("12").to_integer(2), std::runtime_error, Message("Error: Invalid literal for to_integer()."));
+        REQUIRE_THROWS_MATCHES(Str("1 2").to_integer(), std::runtime_error, Message("Error: Invalid literal for to_integer()."));
+        REQUIRE_THROWS_MATCHES(Str("\xff").to_integer(), std::runtime_error, Message("Error: Invalid literal for to_integer()."));
+    }
+
+    SECTION("to_int64")
+    {
+        REQUIRE(Str("233").to_int64() == 233);
+        REQUIRE(Str("  -233\n").to_int64() == -233);
+        REQUIRE(Str("+0").to_int64() == 0);
+        REQUIRE(Str("000000000000000000000000000012").to_int64() == 12);
+        REQUIRE(Str("1234567890123456789").to_int64() == 1234567890123456789LL);
+        REQUIRE(Str("9223372036854775807").to_int64() == LLONG_MAX);
+        REQUIRE(Str("-9223372036854775808").to_int64() == LLONG_MIN);
+        REQUIRE(Str("7fffffffffffffff").to_int64(16) == LLONG_MAX);
+        REQUIRE(Str("-zz").to_int64(36) == -(35 * 36 + 35));
+        REQUIRE(Str("101").to_int64(2) == 5);
+
+        REQUIRE_THROWS_MATCHES(Str("9223372036854775808").to_int64(), std::runtime_error, Message("Error: Integer overflow for to_int64()."));
+        REQUIRE_THROWS_MATCHES(Str("-9223372036854775809").to_int64(), std::runtime_error, Message("Error: Integer overflow for to_int64()."));
+        REQUIRE_THROWS_MATCHES(Str("99999999999999999999999").to_int64(), std::runtime_error, Message("Error: Integer overflow for to_int64()."));
+        REQUIRE_THROWS_MATCHES(Str("8000000000000000").to_int64(16), std::runtime_error, Message("Error: Integer overflow for to_int64()."));
+        REQUIRE_THROWS_MATCHES(Str("").to_int64(), std::runtime_error, Message("Error: Invalid literal for to_int64()."));
+        REQUIRE_THROWS_MATCHES(Str("-").to_int64(), std::runtime_error, Message("Error: Invalid literal for to_int64()."));
+        REQUIRE_THROWS_MATCHES(Str("1 2").to_int64(), std::runtime_error, Message("Error: Invalid literal for to_int64()."));
+        REQUIRE_THROWS_MATCHES(Str("12").to_int64(2), std::runtime_error, Message("Error: Invalid literal for to_int64()."));
+        REQUIRE_THROWS_MATCHES(Str("1").to_int64(37), std::runtime_error, Message("Error: Invalid base for to_int64()."));
+
+        // random values, checked against to_integer()
+        std::mt19937_64 gen(233);
+        for (int i = 0; i < 10000; ++i)
+        {
+            const long long value = static_cast<long long>(gen()) >> (gen() % 64);
+            REQUIRE(Str(std::to_string(value)).to_int64() == value);
+        }
+    }
+
+    SECTION("parse_ints")
+    {
+        REQUIRE(Str("").parse_ints() == List<long long>{});
+        REQUIRE(Str("1 -2\n3").parse_ints() == List<long long>{1, -2, 3});
+        REQUIRE(Str("1, 2 ,3,  -9223372036854775808").parse_ints() == List<long long>{1, 2, 3, LLONG_MIN});
+        REQUIRE(Str("1;2 ; 3").parse_ints(';') == List<long long>{1, 2, 3});
+        REQUIRE(Str("12345678901234567,+00000000000000000000001").parse_ints() == List<long long>{12345678901234567LL, 1});
+
+        REQUIRE(Str("1, 99999999999999999999, -9223372036854775808").parse_ints<Int>() == List<Int>{1, Int("99999999999999999999"), Int("-9223372036854775808")});
+
+        REQUIRE_THROWS_MATCHES(Str("1, 99999999999999999999").parse_ints(), std::runtime_error, Message("Error: Integer overflow for parse_ints()."));
+        REQUIRE_THROWS_MATCHES(Str("1,").parse_ints(), std::runtime_error, Message("Error: Invalid literal for parse_ints()."));
+        REQUIRE_THROWS_MATCHES(Str("1,,2").parse_ints(), std::runtime_error, Message("Error: Invalid literal for parse_ints()."));
+        REQUIRE_THROWS_MATCHES(Str("1.5").parse_ints(), std::runtime_error, Message("Error: Invalid literal for parse_ints()."));
+        REQUIRE_THROWS_MATCHES(Str("1;2").parse_ints(), std::runtime_error, Message("Error: Invalid literal for parse_ints()."));
     }
 
     SECTION("reverse")
@@ -283,6 +427,53 @@ TEST_CASE("Str")
         REQUIRE(some.reverse() == "54321");
     }
 
+    SECTION("utf8")
+    {
+        Str hello = "h\xc3\xa9llo, \xe4\xb8\x96\xe7\x95\x8c! \xf0\x9f\x98\x80"; // "héllo, 世界! 😀"
+
+        REQUIRE(hello.is_valid_utf8());
+        REQUIRE(empty.is_valid_utf8());
+        REQUIRE(Str("plain ascii text, longer than one word").is_valid_utf8());
+        REQUIRE(!Str("\x80").is_valid_utf8());                   // lone continuation byte
+        REQUIRE(!Str("\xc0\xaf").is_valid_utf8());               // overlong
+        REQUIRE(!Str("\xe0\x80\xaf").is_valid_utf8());           // overlong
+        REQUIRE(!Str("\xed\xa0\x80").is_valid_utf8());           // surrogate
+        REQUIRE(!Str("\xf4\x90\x80\x80").is_valid_utf8());       // > U+10FFFF
+        REQUIRE(!Str("abcdefgh\xe4\xb8").is_valid_utf8());       // truncated
+        REQUIRE(!Str("\xff").is_valid_utf8());
+        REQUIRE(Str("\xef\xbf\xbd").is_valid_utf8());            // U+FFFD itself
+        REQUIRE(Str("\xf4\x8f\xbf\xbf").is_valid_utf8());        // U+10FFFF
+
+        REQUIRE(hello.size() == 20);
+        REQUIRE(hello.utf8_size() == 12);
+        REQUIRE(empty.utf8_size() == 0);
+
+        List<int> cps; // char32_t is not printable
+        for (char32_t cp : hello.code_points())
+        {
+            cps += int(cp);
+        }
+        REQUIRE(cps == List<int>{'h', 0xE9, 'l', 'l', 'o', ',', ' ', 0x4E16, 0x754C, '!', ' ', 0x1F600});
+        cps.clear();
+        Str invalid = "a\xffz\xe4\xb8";
+        for (char32_t cp : invalid.code_points())
+        {
+            cps += int(cp);
+        }
+        REQUIRE(cps == List<int>{'a', 0xFFFD, 'z', 0xFFFD, 0xFFFD});
+
+        REQUIRE(hello.utf8_reverse() == "\xf0\x9f\x98\x80 !\xe7\x95\x8c\xe4\xb8\x96 ,oll\xc3\xa9h");
+        REQUIRE(hello.utf8_reverse().utf8_reverse() == hello);
+        REQUIRE(empty.utf8_reverse() == empty);
+
+        REQUIRE(hello.utf8_slice(0, 2) == "h\xc3\xa9");
+        REQUIRE(hello.utf8_slice(7, 9) == "\xe4\xb8\x96\xe7\x95\x8c");
+        REQUIRE(hello.utf8_slice(-1, 12) == "\xf0\x9f\x98\x80");
+        REQUIRE(hello.utf8_slice(0, 12) == hello);
+        REQUIRE(hello.utf8_slice(5, 2) == "");
+        REQUIRE_THROWS_MATCHES(hello.utf8_slice(0, 13), std::runtime_error, Message("Error: Index out of range."));
+    }
+
     SECTION("lower_upper")
     {
         REQUIRE(Str("HAHAHA").lower() == "hahaha");
@@ -290,6 +481,51 @@ TEST_CASE("Str")
 
         REQUIRE(Str("hahaha").upper() == "HAHAHA");
         REQUIRE(Str("some@earth.com").upper() == "SOME@EARTH.COM");
+
+        REQUIRE(Str("").lower() == "");
+        REQUIRE(Str("The Quick Brown Fox Jumps Over @[`{ 123").lower() == "the quick brown fox jumps over @[`{ 123");
+        REQUIRE(Str("The Quick Brown Fox Jumps Over @[`{ 123").upper() == "THE QUICK BROWN FOX JUMPS OVER @[`{ 123");
+        REQUIRE(Str("\xc3\x80\xc3\xa0 ABCDEFGH").lower() == "\xc3\x80\xc3\xa0 abcdefgh");
+    }
+
+    SECTION("casefold")
+    {
+        REQUIRE(Str("Hello, World! 123").casefold_equals("hELLO, wORLD! 123"));
+        REQUIRE(!Str("Hello, World! 123").casefold_equals("hELLO, wORLD! 124"));
+        REQUIRE(!Str("Hello").casefold_equals("Hello!"));
+        REQUIRE(!Str("@").casefold_equals("`"));
+        REQUIRE(Str("").casefold_equals(""));
+
+        REQUIRE(Str("Content-Type").casefold_hash() == Str("CONTENT-TYPE").casefold_hash());
+        REQUIRE(Str("Content-Type").casefold_hash() == Str("content-type").casefold_hash());
+        REQUIRE(Str("Content-Type").casefold_hash() != Str("Content-Types").casefold_hash());
+    }
+
+    SECTION("predicates")
+    {
+        REQUIRE(Str("").is_ascii());
+        REQUIRE(Str("hello, world!\x7f").is_ascii());
+        REQUIRE(!Str("hello, world!\x80").is_ascii());
+
+        REQUIRE(Str("0123456789").is_digit());
+        REQUIRE(!Str("").is_digit());
+        REQUIRE(!Str("012345678.9").is_digit());
+
+        REQUIRE(Str("abcXYZabcXYZ").is_alpha());
+        REQUIRE(!Str("").is_alpha());
+        REQUIRE(!Str("abcXYZ@abcXYZ").is_alpha());
+
+        REQUIRE(Str(" \t\n\v\f\r  ").is_space());
+        REQUIRE(!Str("").is_space());
+        REQUIRE(!Str(" \t\n\v\f\r \b").is_space());
+
+        REQUIRE(Str("hello, world!").is_lower());
+        REQUIRE(!Str("Hello, world!").is_lower());
+        REQUIRE(!Str("123").is_lower());
+
+        REQUIRE(Str("HELLO, WORLD!").is_upper());
+        REQUIRE(!Str("HELLO, WORLd!").is_upper());
+        REQUIRE(!Str("").is_upper());
     }
 
     SECTION("erase")
@@ -313,6 +549,10 @@ TEST_CASE("Str")
         REQUIRE(Str("").replace("abc", "~~~") == "");
         REQUIRE(Str("hahaha").replace("h", "l") == "lalala");
         REQUIRE(Str("hahaha").replace("a", "ooow~").replace("ooow", "o") == "ho~ho~ho~");
+        REQUIRE(Str("aaaa").replace("aa", "b") == "bb");
+        REQUIRE(Str("abab").replace("b", "") == "aa");
+        REQUIRE(Str("abc").replace("x", "yyy") == "abc");
+        REQUIRE(Str("").replace("", "-") == "-");
     }
 
     SECTION("strip")
@@ -322,6 +562,17 @@ TEST_CASE("Str")
         REQUIRE(Str("           hello           ").strip() == "hello");
         REQUIRE(Str("\n\n\n\n \t\n\b\n   hello  \n\n\t\n \r\b\n\r").strip() == "hello");
         REQUIRE(Str("'''hello'''").strip('\'') == "hello");
+        REQUIRE(Str("").strip() == "");
+        REQUIRE(Str("                   ").strip() == "");
+        REQUIRE(Str("  a  b                  ").strip() == "a  b");
+        REQUIRE(Str("  \xe4\xbd\xa0\xe5\xa5\xbd  ").strip() == "\xe4\xbd\xa0\xe5\xa5\xbd");
+        REQUIRE(Str("\xe4\xe4hi\xe4").strip('\xe4') == "hi");
+
+        REQUIRE(Str("  hello  ").lstrip() == "hello  ");
+        REQUIRE(Str("  hello  ").rstrip() == "  hello");
+        REQUIRE(Str("xxxxxxxxxxhelloxxxxxxxxxx").lstrip('x') == "helloxxxxxxxxxx");
+        REQUIRE(Str("xxxxxxxxxxhelloxxxxxxxxxx").rstrip('x') == "xxxxxxxxxxhello");
+        REQUIRE(Str("xxxxxxxxxxxxxxxxxxxx").rstrip('x') == "");
     }
 
     SECTION("rotate")
@@ -347,6 +598,11 @@ TEST_CASE("Str")
         REQUIRE((Str("ABCDEFGHIJK") << 1) == "BCDEFGHIJKA");
         REQUIRE((Str("ABCDEFGHIJK") << 3) == "DEFGHIJKABC");
         REQUIRE((Str("ABCDEFGHIJK") << 11) == "ABCDEFGHIJK");
+
+        REQUIRE((Str("ABCDEFGHIJK") >> 25) == "IJKABCDEFGH");
+        REQUIRE((Str("ABCDEFGHIJK") >> -25) == "DEFGHIJKABC");
+        REQUIRE((Str("ABCDEFGHIJK") << 25) == "DEFGHIJKABC");
+        REQUIRE((Str("ABCDEFGHIJK") << -25) == "IJKABCDEFGH");
     }
 
     SECTION("slice")
@@ -371,6 +627,26 @@ TEST_CASE("Str")
         REQUIRE(some.slice(-1, -1) == "");
         REQUIRE(some.slice(-1, -1, -1) == "");
 
+        // all the slices of a longer string, checked against a naive loop
+        Str alphabet = "abcdefghijklmnopqrstuvwxyz";
+        for (int start = -26; start < 26; ++start)
+        {
+            for (int stop = -27; stop <= 26; ++stop)
+            {
+                for (int step : {-27, -5, -2, -1, 1, 2, 3, 26})
+                {
+                    std::string expected;
+                    int i = start < 0 ? start + 26 : start;
+                    int j = stop < 0 ? stop + 26 : stop;
+                    for (; step > 0 ? i < j : i > j; i += step)
+                    {
+                        expected += alphabet[i];
+                    }
+                    REQUIRE(alphabet.slice(start, stop, step) == Str(expected));
+                }
+            }
+        }
+
         REQUIRE_THROWS_MATCHES(some.slice(1, 2, 0), std::runtime_error, Message("Error: Require step != 0 for slice(start, stop, step)."));
 
         REQUIRE_THROWS_MATCHES(some.slice(-7, -6), std::runtime_error, Message("Error: Index out of range."));
@@ -387,6 +663,12 @@ TEST_CASE("Str")
         REQUIRE(some * 0 == "");
         REQUIRE(some * 1 == "12345");
         REQUIRE(some * 2 == "1234512345");
+        REQUIRE(some * 7 == "12345123451234512345123451234512345");
+        REQUIRE(empty * 100 == "");
+        REQUIRE((one * 1000).size() == 1000);
+        REQUIRE((one * 1000).count("1") == 1000);
+
+        REQUIRE_THROWS_MATCHES(some * -1, std::runtime_error, Message("Error: Require times >= 0 for repeat."));
     }
 
     SECTION("split")
@@ -415,6 +697,7 @@ TEST_CASE("Str")
         REQUIRE(Str(", ").join({"a", "b", "c"}) == "a, b, c");
         REQUIRE(Str("").join({"a", "b", "c"}) == "abc");
         REQUIRE(Str(".").join({"192", "168", "0", "1"}) == "192.168.0.1");
+        REQUIRE(Str("--").join({"", "", ""}) == "----");
     }
 
     SECTION("format")
@@ -424,6 +707,63 @@ TEST_CASE("Str")
         REQUIRE(Str("{} -> {}").format(List<int>{1, 2, 3}, List<Str>{"one", "two", "three"}) == "[1, 2, 3] -> [\"one\", \"two\", \"three\"]");
     }
 
+    SECTION("hash")
+    {
+        std::hash<Str> hash;
+        REQUIRE(hash(Str("hello")) == hash(Str("hello")));
+        REQUIRE(hash(Str("hello")) != hash(Str("hellp")));
+        REQUIRE(hash(Str("")) != hash(Str(std::string(1, '\0'))));
+
+        // cached hash value follows the content
+        Str str = "hello";
+        std::size_t value = hash(str);
+        Str copy = str;
+        REQUIRE(hash(copy) == value);
+        Str moved = std::move(str);
+        REQUIRE(hash(moved) == value);
+        REQUIRE(hash(str) == hash(Str()));
+        copy = "world";
+        REQUIRE(hash(copy) == hash(Str("world")));
+        std::istringstream("hello") >> copy;
+        REQUIRE(hash(copy) == value);
+
+        // all substrings of different lengths crossing the 4, 16 and 48 bytes boundaries
+        Str text = "The quick brown fox jumps over the lazy dog. The quick brown fox jumps over the lazy dog.";
+        List<std::size_t> values;
+        for (int len = 0; len <= text.size(); ++len)
+        {
+            values += hash(text.slice(0, len));
+        }
+        REQUIRE(values.uniquify().size() == text.size() + 1);
+    }
+
+    SECTION("intern")
+    {
+        InternedStr a = Str("content-type").intern();
+        InternedStr b = (Str("content-") + Str("type")).intern();
+        InternedStr c = Str("content-length").intern();
+
+        REQUIRE(a == b);
+        REQUIRE(a.data() == b.data()); // shared
+        REQUIRE(a != c);
+        REQUIRE(c < a);
+        REQUIRE(a.str() == "content-type");
+        REQUIRE(a.size() == 12);
+        REQUIRE(a.hash() == std::hash<Str>{}(Str("content-type")));
+        REQUIRE(std::hash<InternedStr>{}(a) == a.hash());
+        REQUIRE(InternedStr() == Str().intern());
+
+        const int size = InternedStr::pool_size();
+        Str("content-type").intern();
+        REQUIRE(InternedStr::pool_size() == size);
+        Str("content-encoding").intern();
+        REQUIRE(InternedStr::pool_size() == size + 1);
+
+        std::ostringstream oss;
+        oss << a;
+        REQUIRE(oss.str() == "\"content-type\"");
+    }
+
     SECTION("print")
     {
         std::ostringstream oss;
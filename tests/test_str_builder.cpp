@@ -0,0 +1,104 @@
+#include "../sources/str_builder.hpp"
+
+#include "tool.hpp"
+
+using namespace pyincpp;
+
+TEST_CASE("StrBuilder")
+{
+    SECTION("basics")
+    {
+        // StrBuilder()
+        StrBuilder sb1;
+        REQUIRE(sb1.size() == 0);
+        REQUIRE(sb1.is_empty());
+
+        // StrBuilder(int capacity)
+        StrBuilder sb2(100);
+        REQUIRE(sb2.size() == 0);
+        REQUIRE(sb2.is_empty());
+        REQUIRE(sb2.capacity() >= 100);
+    }
+
+    SECTION("reserve")
+    {
+        StrBuilder sb;
+        sb.reserve(1000);
+        REQUIRE(sb.capacity() >= 1000);
+
+        sb.append('x');
+        const int capacity = sb.capacity();
+        for (int i = 1; i < 1000; ++i)
+        {
+            sb.append('x');
+        }
+        REQUIRE(sb.capacity() == capacity); // no reallocation
+        REQUIRE(sb.size() == 1000);
+
+        REQUIRE_THROWS_MATCHES(sb.reserve(-1), std::runtime_error, Message("Error: Require capacity >= 0 for reserve(capacity)."));
+    }
+
+    SECTION("append")
+    {
+        StrBuilder sb;
+        sb.append(Str("hello")).append(' ').append("world").append('!');
+        REQUIRE(sb.build() == "hello world!");
+
+        sb.append(0).append(' ').append(-123).append(' ').append(1234567890123ll);
+        REQUIRE(sb.build() == "0 -123 1234567890123");
+
+        sb.append(true).append(' ').append(false);
+        REQUIRE(sb.build() == "1 0");
+
+        sb.append(0.5).append(' ').append(-1e100).append(' ').append(1.0 / 3);
+        REQUIRE(sb.build() == "0.5 -1e+100 0.333333");
+
+        sb.append(Int()).append(' ').append(Int("-1000000000")).append(' ').append(Int("123456789000000000000000001"));
+        REQUIRE(sb.build() == "0 -1000000000 123456789000000000000000001");
+
+        sb.append(Fraction(3)).append(' ').append(Fraction(-1, 2));
+        REQUIRE(sb.build() == "3 -1/2");
+
+        sb.append(Complex(1, -2)).append(' ').append(Complex(0.5, 2));
+        REQUIRE(sb.build() == "(1-2j) (0.5+2j)");
+    }
+
+    SECTION("append_container")
+    {
+        StrBuilder sb;
+
+        sb.append(List<int>{}).append(List<Int>{"1", "23"}).append(List<Str>{"a", "b"});
+        REQUIRE(sb.build() == "[][1, 23][\"a\", \"b\"]");
+
+        sb.append(List<bool>{true, false});
+        REQUIRE(sb.build() == "[1, 0]");
+
+        sb.append(Set<char>{'a', 'b'}).append(Deque<Fraction>{{1, 2}, 3});
+        REQUIRE(sb.build() == "{a, b}<1/2, 3>");
+
+        sb.append(Dict<Str, List<Int>>{{"first", {"123", "456"}}, {"second", {"789"}}});
+        REQUIRE(sb.build() == "{\"first\": [123, 456], \"second\": [789]}");
+
+        sb.append(make_tuple(1)).append(make_tuple(1, Str("two"), List<Complex>{{1, 2}}));
+        REQUIRE(sb.build() == "(1,)(1, \"two\", [(1+2j)])");
+
+        // same as operator<<
+        Dict<Str, List<Int>> dict = {{"first", {"123", "456"}}, {"second", {"789"}}, {"third", {"12345678987654321", "5"}}};
+        std::ostringstream oss;
+        oss << dict;
+        REQUIRE(sb.append(dict).build() == oss.str());
+    }
+
+    SECTION("build")
+    {
+        StrBuilder sb;
+        sb.append("abc");
+        REQUIRE(sb.build() == "abc");
+        REQUIRE(sb.is_empty());
+        REQUIRE(sb.build() == "");
+
+        sb.append("abc");
+        sb.clear();
+        REQUIRE(sb.is_empty());
+    }
+}
@@ -0,0 +1,148 @@
+#include "../sources/str_view.hpp"
+
+#include "tool.hpp"
+
+#include <cstdio> // std::remove
+
+using namespace pyincpp;
+
+TEST_CASE("StrView")
+{
+    Str text = "one, two, three";
+    StrView empty;
+    StrView view = text;
+
+    // a temporary file for read_file() and map_file()
+    const Str path = "pyincpp_test_str_view.txt";
+    std::ofstream(path.data(), std::ios::binary) << "1.5, 2e3\n-3, inf\n";
+
+    SECTION("basics")
+    {
+        REQUIRE(empty.size() == 0);
+        REQUIRE(empty.is_empty());
+
+        REQUIRE(view.size() == 15);
+        REQUIRE(!view.is_empty());
+        REQUIRE(view.data() == text.data());
+        REQUIRE(view.to_str() == text);
+
+        REQUIRE(StrView("hello", 4) == "hell");
+        REQUIRE(StrView("abc") < StrView("abd"));
+    }
+
+    SECTION("access")
+    {
+        REQUIRE(view[0] == 'o');
+        REQUIRE(view[-1] == 'e');
+        REQUIRE(Str(std::string(view.begin(), view.end())) == text);
+
+        REQUIRE_THROWS_MATCHES(view[15], std::runtime_error, Message("Error: Index out of range."));
+    }
+
+    SECTION("find")
+    {
+        REQUIRE(view.find("two") == 5);
+        REQUIRE(view.find("four") == -1);
+        REQUIRE(view.find("o", 3) == 7);
+        REQUIRE(view.contains(", t"));
+
+        REQUIRE(view.count(", ") == 2);
+        REQUIRE(view.count("") == 16);
+        REQUIRE(view.count("x") == 0);
+    }
+
+    SECTION("slice_split")
+    {
+        REQUIRE(view.slice(5, 8) == "two");
+        REQUIRE(view.slice(-5, 15) == "three");
+        REQUIRE(view.slice(8, 5) == "");
+        REQUIRE(view.slice(5, 8).data() == text.data() + 5); // no copy
+
+        REQUIRE(view.split(", ") == List<StrView>{"one", "two", "three"});
+        REQUIRE(StrView("aaa").split("a", true) == List<StrView>{"", "", "", ""});
+        REQUIRE(StrView("   1   2   3   ").split() == List<StrView>{"1", "2", "3"});
+
+        REQUIRE_THROWS_MATCHES(view.split(""), std::runtime_error, Message("Error: Empty separator."));
+    }
+
+    SECTION("to_decimal")
+    {
+        REQUIRE(StrView(" 233.33 ").to_decimal() == 233.33);
+        REQUIRE(view.split(", ").size() == 3);
+        REQUIRE(StrView("1.5 2e3\n-3").parse_decimals() == List<double>{1.5, 2000, -3});
+        REQUIRE(StrView("1 2\n-3").parse_ints() == List<long long>{1, 2, -3});
+        REQUIRE(StrView("1;99999999999999999999").parse_ints<Int>(';') == List<Int>{1, Int("99999999999999999999")});
+
+        REQUIRE_THROWS_MATCHES(view.to_decimal(), std::runtime_error, Message("Error: Invalid literal for to_decimal()."));
+    }
+
+    SECTION("read_file")
+    {
+        Str contents = Str::read_file(path);
+        REQUIRE(contents == "1.5, 2e3\n-3, inf\n");
+        REQUIRE(contents.parse_decimals() == List<double>{1.5, 2000, -3, INFINITY});
+
+        REQUIRE_THROWS_MATCHES(Str::read_file("no_such_file.txt"), std::runtime_error, Message("Error: Cannot open the file."));
+        REQUIRE_THROWS_AS(Str::read_file("."), std::runtime_error); // a directory can not be read (or opened on some platforms)
+    }
+
+    SECTION("map_file")
+    {
+        StrView file = StrView::map_file(path);
+        REQUIRE(file == "1.5, 2e3\n-3, inf\n");
+        REQUIRE(file.count("\n") == 2);
+        REQUIRE(file.parse_decimals() == List<double>{1.5, 2000, -3, INFINITY});
+
+        // the lines keep the mapping alive
+        List<StrView> lines = StrView::map_file(path).split("\n");
+        REQUIRE(lines == List<StrView>{"1.5, 2e3", "-3, inf"});
+        REQUIRE(lines[1].split(", ")[0].to_decimal() == -3);
+
+        std::ofstream(path.data(), std::ios::binary).close();
+        REQUIRE(StrView::map_file(path).is_empty());
+
+        REQUIRE_THROWS_MATCHES(StrView::map_file("no_such_file.txt"), std::runtime_error, Message("Error: Cannot open the file."));
+    }
+
+#ifndef _WIN32
+    SECTION("map_large_file")
+    {
+        // a sparse file larger than INT_MAX bytes, only its last page is written
+        const Str large = "pyincpp_test_str_view_large.txt";
+        const std::ptrdiff_t size = std::ptrdiff_t(INT_MAX) + 16;
+        {
+            std::ofstream out(large.data(), std::ios::binary);
+            out.seekp(size - 8);
+            out << "a,b\nend\n";
+        }
+
+        StrView file = StrView::map_file(large);
+        REQUIRE(file.size() == size);
+        REQUIRE(file[-1] == '\n');
+        REQUIRE(file.find("end", size - 16) == size - 4);
+        REQUIRE(file.slice(-8, size).split("\n") == List<StrView>{"a,b", "end"});
+        REQUIRE(file.slice(-8, -5).count(",") == 1);
+        REQUIRE(file.slice(size - 4, size - 1).to_str() == "end");
+
+        REQUIRE_THROWS_MATCHES(file.to_str(), std::runtime_error, Message("Error: The view is too large for a string."));
+        REQUIRE_THROWS_MATCHES(Str::read_file(large), std::runtime_error, Message("Error: The file is too large."));
+
+        std::remove(large.data());
+    }
+#endif
+
+    SECTION("print")
+    {
+        std::ostringstream oss;
+
+        oss << empty;
+        REQUIRE(oss.str() == "\"\"");
+        oss.str("");
+
+        oss << view.slice(0, 3);
+        REQUIRE(oss.str() == "\"one\"");
+        oss.str("");
+    }
+
+    std::remove(path.data());
+}
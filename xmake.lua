@@ -6,6 +6,10 @@ set_languages("cxx20")
 add_rules("mode.debug", "mode.release")
 add_requires("catch2")
 
+if is_plat("linux") then
+    add_syslinks("pthread") -- parallel algorithms
+end
+
 target("test")
     set_kind("binary")
     add_packages("catch2")